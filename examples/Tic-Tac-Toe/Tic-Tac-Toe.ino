@@ -21,6 +21,8 @@ const byte player_B_pin[LED_SEQ_TOTAL] = {1,5,7,9,11,13,A1,A3,A5};
 
 #define LED_SHOW_TIME  500
 
+#define PONDER_SLICE_US  300  //search time taken from each loop()
+
 GAME_MODE GameMode;
 bool PC_first_step = true;
 	
@@ -77,6 +79,10 @@ void game_start(void)
 			ActiveBlinkLED_Color = LED_COLOR_A;			
 		}
 
+		//PC is color B, think while player is choosing
+		led_square.ponderStart(LED_COLOR_B);
+		led_square.set_PonderHint(ActiveBlinkLED_Seq);
+
 		PC_first_step = !PC_first_step;
 	}
 }
@@ -239,7 +245,13 @@ void button_event(uint8_t click_count)
 						led_square.set_LEDStatus(ActiveBlinkLED_Seq, ActiveBlinkLED_Color, LED_STATUS_OFF);
 						led_square.set_LEDStatus(next_step, ActiveBlinkLED_Color, LED_STATUS_ON);
 
-						game_judeg(ActiveBlinkLED_Color);
+						LED_COLOR PC_color = ActiveBlinkLED_Color;
+
+						if (GAME_STATUS_NEXT_PLAYER == game_judeg(PC_color))
+						{
+							led_square.ponderStart(PC_color);
+							led_square.set_PonderHint(ActiveBlinkLED_Seq);
+						}
 					}
 				}	
 			}
@@ -295,6 +307,8 @@ void encoder_event(ENCODER_RESULT event)
 			default:
 			break;
 		}
+
+		led_square.set_PonderHint(ActiveBlinkLED_Seq);
 	}
 }
 
@@ -325,6 +339,11 @@ void loop()
 	}
 
 	led_square.blinkRoutine();
+
+	if (GAME_MODE_PLAYER_VS_COMPUTER == GameMode)
+	{
+		led_square.ponderRoutine(PONDER_SLICE_US);
+	}
 }
 
 /*
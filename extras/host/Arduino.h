@@ -0,0 +1,142 @@
+/**
+  * @file      Arduino.h
+  * @version   v1.0
+  * @author    3lectron3ats <3lectron3ats@gmail.com>
+  * @date      2026.10.16
+  * @brief     Minimal Arduino core stub, build the game engine on a Linux host.
+  * @copyright GPL v3.0
+  * *************************************************************************************
+  * @attention
+  * <h2><center>&copy; COPYRIGHT 2023 3lectron3ats </center></h2>
+  * *************************************************************************************
+  * @note
+  *   Only what the engine part of the library touches is provided. Pin I/O is a no-op,
+  *   PROGMEM is ordinary memory and the serial port prints to stdout.
+  *   Build with:
+  *       g++ -O2 -fpermissive -w -DARDUINO=100 -DEE33_HOST_BUILD
+  *           -Iextras/host -Isrc <tool>.cpp src/EE33_LED.cpp ...
+  */
+
+#ifndef EE33_HOST_ARDUINO_H
+#define EE33_HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+
+typedef uint8_t byte;
+typedef bool    boolean;
+
+#define HIGH    0x1
+#define LOW     0x0
+
+#define INPUT   0x0
+#define OUTPUT  0x1
+
+#define A0      14
+#define A1      15
+#define A2      16
+#define A3      17
+#define A4      18
+#define A5      19
+#define A6      20
+#define A7      21
+
+#define bit(b)  (1UL << (b))
+
+#define PROGMEM
+#define pgm_read_byte(addr)   (*(const uint8_t *)(addr))
+#define pgm_read_word(addr)   (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr)  (*(const uint32_t *)(addr))
+#define memcpy_P(dest, src, n) memcpy((dest), (src), (n))
+
+#define TXEN0   3
+
+/** USART0 control register B, the print macros toggle the transmitter bit */
+static uint8_t UCSR0B;
+
+inline void pinMode(uint8_t pin, uint8_t mode) { (void)pin; (void)mode; }
+inline void digitalWrite(uint8_t pin, uint8_t val) { (void)pin; (void)val; }
+inline int  digitalRead(uint8_t pin) { (void)pin; return LOW; }
+inline int  analogRead(uint8_t pin) { (void)pin; return 0; }
+inline void analogWrite(uint8_t pin, int val) { (void)pin; (void)val; }
+
+/** 32 bits like unsigned long of AVR, so micros() - start wraps the same way */
+inline uint32_t micros(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint32_t)((unsigned long)ts.tv_sec * 1000000UL + ts.tv_nsec / 1000);
+}
+
+inline uint32_t millis(void)
+{
+	return micros() / 1000;
+}
+
+inline void delay(unsigned long ms) { (void)ms; }
+
+/**
+	* @brief  forced result of random(), negative means use the generator
+	* @note   host tools set it to walk through every tie-break choice
+	*/
+inline long &host_random_force(void)
+{
+	static long force = -1;
+
+	return force;
+}
+
+inline void randomSeed(unsigned long seed)
+{
+	srand((unsigned int)seed);
+}
+
+inline long random(long howbig)
+{
+	if (host_random_force() >= 0)
+	{
+		return host_random_force();
+	}
+
+	return (howbig) ? rand() % howbig : 0;
+}
+
+inline long random(long howsmall, long howbig)
+{
+	return (howsmall < howbig) ? howsmall + random(howbig - howsmall) : howsmall;
+}
+
+class HostSerial
+{
+public:
+	void begin(unsigned long baud) { (void)baud; }
+	void end(void) {}
+	void flush(void) { fflush(stdout); }
+
+	void print(const char *s) { fputs(s, stdout); }
+	void print(long n) { printf("%ld", n); }
+	void print(unsigned long n) { printf("%lu", n); }
+	void print(int n) { printf("%d", n); }
+	void print(unsigned int n) { printf("%u", n); }
+	void print(double n) { printf("%.2f", n); }
+
+	void println(void) { fputs("\r\n", stdout); }
+	template <typename T> void println(T v) { print(v); println(); }
+};
+
+static HostSerial Serial;
+
+#endif  //EE33_HOST_ARDUINO_H
+
+
+/*
+ * @release note
+ * | v1.0 2026-10-16 - 3lectron3ats : Initial Release
+ * #
+*/
@@ -0,0 +1,283 @@
+/**
+  * @file      profile_fw.ino
+  * @version   v1.0
+  * @author    3lectron3ats <3lectron3ats@gmail.com>
+  * @date      2026.10.16
+  * @brief     Firmware of the simavr profile harness, runs scenarios and marks them.
+  * @copyright GPL v3.0
+  * *************************************************************************************
+  * @attention
+  * <h2><center>&copy; COPYRIGHT 2023 3lectron3ats </center></h2>
+  * *************************************************************************************
+  * @note
+  *   Same pins and objects as examples/Tic-Tac-Toe. Every scenario is put between two
+  *   writes to GPIOR0, which profile_run catches with the cycle counter of the emulated
+  *   ATmega328P; nothing is measured on the chip itself, so the numbers are exact and
+  *   the firmware pays no cost for them.
+  *     GPIOR0  scenario id on start, id | PROFILE_MARK_END on end, PROFILE_MARK_DONE last
+  *     GPIOR2  data bytes, LSB first, read by profile_run as one 32-bit value
+  *     GPIOR1  stimulus kind, profile_run then makes GPIOR2 value edges or presses
+  *   Bit scenarios run one function on all 512 boards, cycles / 512 is the cost of a
+  *   call; each old loop the search used comes right before the MatrixBit call that
+  *   replaced it, the same set as extras/tools/bit_bench on host.
+  *   MCTS scenario runs MctsBoard<4,4,4> BestNextMove on the empty board for a fixed
+  *   number of iterations and sends playouts, so profile_run gives cycles per playout.
+  *   Build, see profile_run.c.
+  */
+
+
+#include <EE33_Tic_Tac_Toe.h>
+#include <EE33_EncoderButton.h>
+#include <EE33_LED.h>
+#include <EE33_Mcts.h>
+
+const byte player_A_pin[LED_SEQ_TOTAL] = {0,4,6,8,10,12,A0,A2,A4};
+const byte player_B_pin[LED_SEQ_TOTAL] = {1,5,7,9,11,13,A1,A3,A5};
+
+const LED_SQUARE led_square(player_A_pin, player_B_pin);
+
+Button button(EXTERNAL_INTERRUPT_D3, 400);
+Encoder encoder(EXTERNAL_INTERRUPT_D2, A6);
+
+/** 64 nodes take 576 bytes, what is left of SRAM besides led_square */
+MctsBoard<4, 4, 4, 64> mcts_board;
+
+/** GPIOR0 values besides scenario id, keep in step with profile_run.c */
+#define PROFILE_MARK_END             0x80
+#define PROFILE_MARK_DONE            0xFF
+
+/** GPIOR1 values */
+#define PROFILE_STIMULUS_ENCODER_CW  1
+#define PROFILE_STIMULUS_ENCODER_CCW 2
+#define PROFILE_STIMULUS_BUTTON      3
+
+/** edges and presses of input scenarios */
+#define PROFILE_INPUT_COUNT          16
+
+/** give up waiting for input events, in ms of emulated time */
+#define PROFILE_INPUT_TIMEOUT_MS     20000
+
+/** iterations of MCTS scenario */
+#define PROFILE_MCTS_ITERATIONS      200
+
+/*! fixed position for BestNextMove, bit n is LED_SEQUENCE n */
+typedef struct
+{
+	uint16_t map_A;
+	uint16_t map_B;
+	LED_COLOR color;           /*!< the one to move */
+} T_PROFILE_POSITION;
+
+const T_PROFILE_POSITION profile_position[] =
+{
+	{0x000, 0x000, LED_COLOR_A},    //empty board
+	{0x010, 0x000, LED_COLOR_B},    //A in center
+	{0x001, 0x010, LED_COLOR_A},    //corner and center
+	{0x101, 0x010, LED_COLOR_B},    //B must block
+	{0x011, 0x104, LED_COLOR_A},    //mid game
+	{0x0A1, 0x114, LED_COLOR_A},    //late game
+};
+
+#define PROFILE_POSITION_TOTAL  (sizeof(profile_position) / sizeof(profile_position[0]))
+
+__attribute__((noinline)) static uint8_t kernighan_count(uint16_t map)
+{
+	uint32_t n = map;  //old _minmax_popcount took uint32_t
+	uint8_t count = 0;
+
+	for (; n; n &= n - 1, count++);
+
+	return count;
+}
+
+__attribute__((noinline)) static uint8_t matrix_count(uint16_t map)
+{
+	return MatrixBit::count(map);
+}
+
+__attribute__((noinline)) static uint8_t builtin_count(uint16_t map)
+{
+	return __builtin_popcount(map);
+}
+
+__attribute__((noinline)) static uint8_t shift_lowest(uint16_t map)
+{
+	uint8_t index;
+
+	for (index = MATRIX_3X3_M11; index < MATRIX_3X3_ELEMENT_TOTAL && !(map & bit(index)); index++);
+
+	return index;
+}
+
+__attribute__((noinline)) static uint8_t matrix_lowest(uint16_t map)
+{
+	return MatrixBit::lowest(map);
+}
+
+__attribute__((noinline)) static uint8_t kernighan_full(uint16_t map)
+{
+	return kernighan_count(map) == MATRIX_3X3_ELEMENT_TOTAL;
+}
+
+__attribute__((noinline)) static uint8_t matrix_full(uint16_t map)
+{
+	T_MATRIX_3X3 friend_map, enmy_map;
+
+	friend_map.d16 = map;
+	enmy_map.d16 = 0;
+
+	return MatrixBit::Is_Full(friend_map, enmy_map);
+}
+
+/*! bit function of a scenario */
+typedef uint8_t (*P_PROFILE_BIT)(uint16_t map);
+
+const P_PROFILE_BIT profile_bit[] =
+{
+	kernighan_count, matrix_count, builtin_count,
+	shift_lowest, matrix_lowest,
+	kernighan_full, matrix_full,
+};
+
+#define PROFILE_BIT_TOTAL  (sizeof(profile_bit) / sizeof(profile_bit[0]))
+
+static void profile_data(uint32_t value)
+{
+	for (uint8_t i = 0; i < 4; i++, value >>= 8)
+	{
+		GPIOR2 = (uint8_t)value;
+	}
+}
+
+static void profile_best_move(uint8_t id, const T_PROFILE_POSITION *position)
+{
+	T_MINMAX_SEARCH_STATS before, after;
+
+	led_square.set_allOff();
+
+	for (uint8_t seq = LED_1; seq < LED_SEQ_TOTAL; seq++)
+	{
+		if (position->map_A & bit(seq))
+		{
+			led_square.set_LEDStatus(seq, LED_COLOR_A, LED_STATUS_ON);
+		}
+		if (position->map_B & bit(seq))
+		{
+			led_square.set_LEDStatus(seq, LED_COLOR_B, LED_STATUS_ON);
+		}
+	}
+
+	//cold cache, so every run of the harness costs the same
+	led_square.get_Engine()->flush();
+	led_square.get_SearchStats(&before);
+
+	GPIOR0 = id;
+	led_square.BestNextMove(position->color);
+	GPIOR0 = id | PROFILE_MARK_END;
+
+	led_square.get_SearchStats(&after);
+	profile_data(after.node - before.node);
+}
+
+static void profile_bits(uint8_t id, P_PROFILE_BIT func)
+{
+	uint32_t sum = 0;
+
+	GPIOR0 = id;
+
+	for (uint16_t map = 0; map <= MATRIX_3X3_MASK; map++)
+	{
+		sum += func(map);
+	}
+
+	GPIOR0 = id | PROFILE_MARK_END;
+	profile_data(sum);  //keeps the calls, and tells they agree
+}
+
+static void profile_mcts(uint8_t id)
+{
+	mcts_board.clear();
+	mcts_board.set_Iterations(PROFILE_MCTS_ITERATIONS);
+	mcts_board.reset_Playout();
+
+	GPIOR0 = id;
+	mcts_board.BestNextMove(PLAYER_TYPE_FRIEND);
+	GPIOR0 = id | PROFILE_MARK_END;
+
+	profile_data(mcts_board.get_Playout());
+}
+
+static void profile_input(uint8_t id, uint8_t kind)
+{
+	unsigned long start = millis();
+	uint8_t events = 0;
+
+	while (encoder.available())
+	{
+		encoder.read();
+	}
+	while (button.available())
+	{
+		button.read();
+	}
+
+	GPIOR0 = id;
+	profile_data(PROFILE_INPUT_COUNT);
+	GPIOR1 = kind;
+
+	while (events < PROFILE_INPUT_COUNT && millis() - start < PROFILE_INPUT_TIMEOUT_MS)
+	{
+		if (kind == PROFILE_STIMULUS_BUTTON)
+		{
+			//a multi-click is one event with the count of clicks
+			events += (button.available()) ? button.read() : 0;
+		}
+		else if (encoder.available())
+		{
+			events += (encoder.read() == ((kind == PROFILE_STIMULUS_ENCODER_CW) ? ENCODER_CLOCKWISE : ENCODER_COUNTERCLOCKWISE));
+		}
+	}
+
+	GPIOR0 = id | PROFILE_MARK_END;
+	profile_data(events);
+}
+
+void setup()
+{
+	uint8_t id = 1;
+
+	led_square.begin();
+	button.begin();
+	encoder.begin();
+
+	randomSeed(1);
+
+	for (uint8_t i = 0; i < PROFILE_POSITION_TOTAL; i++)
+	{
+		profile_best_move(id++, &profile_position[i]);
+	}
+
+	profile_input(id++, PROFILE_STIMULUS_ENCODER_CW);
+	profile_input(id++, PROFILE_STIMULUS_ENCODER_CCW);
+	profile_input(id++, PROFILE_STIMULUS_BUTTON);
+
+	for (uint8_t i = 0; i < PROFILE_BIT_TOTAL; i++)
+	{
+		profile_bits(id++, profile_bit[i]);
+	}
+
+	profile_mcts(id++);
+
+	GPIOR0 = PROFILE_MARK_DONE;
+}
+
+void loop()
+{
+}
+
+
+/*
+ * @release note
+ * | v1.0 2026-10-16 - 3lectron3ats : Initial Release
+ * #
+*/
@@ -0,0 +1,368 @@
+/**
+  * @file      profile_run.c
+  * @version   v1.0
+  * @author    3lectron3ats <3lectron3ats@gmail.com>
+  * @date      2026.10.16
+  * @brief     Host tool, run profile_fw on an emulated ATmega328P and count its cycles.
+  * @copyright GPL v3.0
+  * *************************************************************************************
+  * @attention
+  * <h2><center>&copy; COPYRIGHT 2023 3lectron3ats </center></h2>
+  * *************************************************************************************
+  * @note
+  *   profile_fw marks each scenario on GPIOR0. Between the marks, every instruction is
+  *   checked for the lowest stack pointer and for a jump into the vector table, which
+  *   starts an ISR; the ISR ends when RETI takes the stack back above where it was.
+  *   Input scenarios ask for encoder edges(D2 falling, level of A6 gives direction) or
+  *   button presses(D3 low) on GPIOR1, driven here by cycle timers at the speed of a
+  *   hand. Cycles of an input scenario are mostly waiting, its ISR numbers are the
+  *   point. Result is one JSON object like engine_bench; cycles_per_data is cycles
+  *   divided by data, cycles per node for BestNextMove, per playout for MctsBoard.
+  *   Only simavr and avr-gcc are needed, all offline:
+  *       arduino-cli compile -b arduino:avr:nano --library . --output-dir /tmp/profile_fw
+  *           extras/simavr/profile_fw
+  *       gcc -O2 -o profile_run extras/simavr/profile_run.c -lsimavr -lelf
+  *       ./profile_run /tmp/profile_fw/profile_fw.ino.elf [-o result.json]
+  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <simavr/sim_avr.h>
+#include <simavr/sim_elf.h>
+#include <simavr/sim_cycle_timers.h>
+#include <simavr/avr_ioport.h>
+#include <simavr/avr_adc.h>
+
+/** keep in step with profile_fw.ino */
+#define PROFILE_MARK_END             0x80
+#define PROFILE_MARK_DONE            0xFF
+
+#define PROFILE_STIMULUS_ENCODER_CW  1
+#define PROFILE_STIMULUS_ENCODER_CCW 2
+#define PROFILE_STIMULUS_BUTTON      3
+
+/** data addresses of GPIOR0 ~ 2 and the stack pointer */
+#define PROFILE_GPIOR0               0x3E
+#define PROFILE_GPIOR1               0x4A
+#define PROFILE_GPIOR2               0x4B
+#define PROFILE_SPL                  0x5D
+#define PROFILE_SPH                  0x5E
+
+#define PROFILE_FREQUENCY            16000000
+#define PROFILE_RAMEND               0x8FF
+
+/** jmp vectors of ATmega328P, 4 bytes each */
+#define PROFILE_VECTOR_TOTAL         26
+#define PROFILE_VECTOR_SIZE          4
+
+/** ISRs running at the same time, ISRs of the library do not nest */
+#define PROFILE_ISR_NEST_MAX         4
+
+#define PROFILE_SCENARIO_MAX         32
+
+/** stop a firmware that never says done, in seconds of emulated time */
+#define PROFILE_TIMEOUT_S            120
+
+/** stimulus timing in us, encoder phase check is 1.5ms, button debounce 30ms and click interval 400ms */
+#define PROFILE_ENCODER_LOW_US       1000
+#define PROFILE_ENCODER_PERIOD_US    5000
+#define PROFILE_BUTTON_LOW_US        60000
+#define PROFILE_BUTTON_PERIOD_US     600000
+
+/*! cycles of one vector within a scenario */
+typedef struct
+{
+	uint32_t count;
+	uint64_t total;
+	uint64_t min;
+	uint64_t max;
+} T_PROFILE_ISR;
+
+/*! one scenario between two marks */
+typedef struct
+{
+	uint8_t  id;
+	uint64_t start;            /*!< cycle of start mark */
+	uint64_t cycles;           /*!< end mark - start mark */
+	uint16_t sp_start;
+	uint16_t sp_min;           /*!< lowest stack pointer */
+	uint32_t data;             /*!< value sent after end mark, nodes, input events, sum of bit scenario or playouts */
+	T_PROFILE_ISR isr[PROFILE_VECTOR_TOTAL];
+} T_PROFILE_SCENARIO;
+
+/*! ISR being run */
+typedef struct
+{
+	uint8_t  vector;
+	uint16_t sp;               /*!< stack pointer with return address pushed */
+	uint64_t start;
+} T_PROFILE_ISR_FRAME;
+
+static const char *profile_vector_name[PROFILE_VECTOR_TOTAL] =
+{
+	"RESET", "INT0", "INT1", "PCINT0", "PCINT1", "PCINT2", "WDT",
+	"TIMER2_COMPA", "TIMER2_COMPB", "TIMER2_OVF", "TIMER1_CAPT", "TIMER1_COMPA", "TIMER1_COMPB", "TIMER1_OVF",
+	"TIMER0_COMPA", "TIMER0_COMPB", "TIMER0_OVF", "SPI_STC", "USART_RX", "USART_UDRE", "USART_TX",
+	"ADC", "EE_READY", "ANALOG_COMP", "TWI", "SPM_READY",
+};
+
+static T_PROFILE_SCENARIO scenario[PROFILE_SCENARIO_MAX];
+static uint8_t scenario_total;
+static T_PROFILE_SCENARIO *scenario_now;
+
+static T_PROFILE_ISR_FRAME isr_stack[PROFILE_ISR_NEST_MAX];
+static uint8_t isr_depth;
+
+static uint32_t data_value;
+static uint32_t stimulus_left;
+static uint8_t stimulus_kind;
+static int done;
+
+static uint16_t profile_sp(avr_t *avr)
+{
+	return avr->data[PROFILE_SPL] | (avr->data[PROFILE_SPH] << 8);
+}
+
+static void profile_pin(avr_t *avr, char port, int pin, uint32_t value)
+{
+	avr_raise_irq(avr_io_getirq(avr, AVR_IOCTL_IOPORT_GETIRQ(port), pin), value);
+}
+
+static avr_cycle_count_t stimulus_release(avr_t *avr, avr_cycle_count_t when, void *param)
+{
+	profile_pin(avr, 'D', (stimulus_kind == PROFILE_STIMULUS_BUTTON) ? 3 : 2, 1);
+
+	return 0;
+}
+
+static avr_cycle_count_t stimulus_press(avr_t *avr, avr_cycle_count_t when, void *param)
+{
+	int button = (stimulus_kind == PROFILE_STIMULUS_BUTTON);
+
+	if (!stimulus_left)
+	{
+		return 0;
+	}
+
+	stimulus_left--;
+
+	if (!button)
+	{
+		//B phase is read 1.5ms after A falls, low is clockwise
+		avr_raise_irq(avr_io_getirq(avr, AVR_IOCTL_ADC_GETIRQ, ADC_IRQ_ADC6), (stimulus_kind == PROFILE_STIMULUS_ENCODER_CW) ? 0 : 5000);
+	}
+
+	profile_pin(avr, 'D', button ? 3 : 2, 0);
+	avr_cycle_timer_register_usec(avr, button ? PROFILE_BUTTON_LOW_US : PROFILE_ENCODER_LOW_US, stimulus_release, NULL);
+
+	return when + avr_usec_to_cycles(avr, button ? PROFILE_BUTTON_PERIOD_US : PROFILE_ENCODER_PERIOD_US);
+}
+
+static void gpior0_write(avr_t *avr, avr_io_addr_t addr, uint8_t v, void *param)
+{
+	avr->data[addr] = v;
+
+	if (v == PROFILE_MARK_DONE)
+	{
+		done = 1;
+	}
+	else if (!(v & PROFILE_MARK_END) && scenario_total < PROFILE_SCENARIO_MAX)
+	{
+		scenario_now = &scenario[scenario_total++];
+		memset(scenario_now, 0, sizeof(*scenario_now));
+		scenario_now->id = v;
+		scenario_now->start = avr->cycle;
+		scenario_now->sp_start = scenario_now->sp_min = profile_sp(avr);
+		isr_depth = 0;
+	}
+	else if (scenario_now && (v & ~PROFILE_MARK_END) == scenario_now->id)
+	{
+		scenario_now->cycles = avr->cycle - scenario_now->start;
+		stimulus_left = 0;
+	}
+
+	data_value = 0;
+}
+
+static void gpior1_write(avr_t *avr, avr_io_addr_t addr, uint8_t v, void *param)
+{
+	avr->data[addr] = v;
+
+	stimulus_kind = v;
+	stimulus_left = data_value;
+	avr_cycle_timer_register_usec(avr, PROFILE_ENCODER_PERIOD_US, stimulus_press, NULL);
+}
+
+static void gpior2_write(avr_t *avr, avr_io_addr_t addr, uint8_t v, void *param)
+{
+	avr->data[addr] = v;
+
+	data_value = (data_value >> 8) | ((uint32_t)v << 24);
+
+	if (scenario_now)
+	{
+		scenario_now->data = data_value;
+	}
+}
+
+/** after every instruction, follow stack and ISRs of the running scenario */
+static void profile_step(avr_t *avr)
+{
+	uint16_t sp = profile_sp(avr);
+	T_PROFILE_ISR *isr;
+
+	if (!scenario_now || scenario_now->cycles)
+	{
+		return;
+	}
+
+	if (sp < scenario_now->sp_min)
+	{
+		scenario_now->sp_min = sp;
+	}
+
+	while (isr_depth && sp > isr_stack[isr_depth - 1].sp)
+	{
+		uint64_t cycles;
+
+		isr_depth--;
+		isr = &scenario_now->isr[isr_stack[isr_depth].vector];
+		cycles = avr->cycle - isr_stack[isr_depth].start;
+
+		isr->count++;
+		isr->total += cycles;
+		isr->min = (!isr->min || cycles < isr->min) ? cycles : isr->min;
+		isr->max = (cycles > isr->max) ? cycles : isr->max;
+	}
+
+	if (avr->pc && avr->pc < PROFILE_VECTOR_TOTAL * PROFILE_VECTOR_SIZE && !(avr->pc % PROFILE_VECTOR_SIZE) && isr_depth < PROFILE_ISR_NEST_MAX)
+	{
+		isr_stack[isr_depth].vector = avr->pc / PROFILE_VECTOR_SIZE;
+		isr_stack[isr_depth].sp = sp;
+		isr_stack[isr_depth].start = avr->cycle;
+		isr_depth++;
+	}
+}
+
+static void profile_print(FILE *file)
+{
+	fprintf(file, "{\n");
+	fprintf(file, "  \"tool\": \"profile_run\",\n");
+	fprintf(file, "  \"mcu\": \"atmega328p\",\n");
+	fprintf(file, "  \"frequency\": %u,\n", PROFILE_FREQUENCY);
+	fprintf(file, "  \"done\": %s,\n", done ? "true" : "false");
+	fprintf(file, "  \"scenarios\": [\n");
+
+	for (uint8_t i = 0; i < scenario_total; i++)
+	{
+		T_PROFILE_SCENARIO *s = &scenario[i];
+		int first = 1;
+
+		fprintf(file, "    {\"id\": %u, \"cycles\": %llu, \"us\": %.1f, \"data\": %u, ", s->id, (unsigned long long)s->cycles,
+			s->cycles * 1e6 / PROFILE_FREQUENCY, s->data);
+		fprintf(file, "\"cycles_per_data\": %.1f, ", (s->data) ? (double)s->cycles / s->data : 0.0);
+		fprintf(file, "\"stack_peak\": %u, \"stack_used\": %u, \"isr\": {", PROFILE_RAMEND - s->sp_min, s->sp_start - s->sp_min);
+
+		for (uint8_t v = 0; v < PROFILE_VECTOR_TOTAL; v++)
+		{
+			if (!s->isr[v].count)
+			{
+				continue;
+			}
+
+			fprintf(file, "%s\"%s\": {\"count\": %u, \"min\": %llu, \"max\": %llu, \"mean\": %.1f}", first ? "" : ", ", profile_vector_name[v],
+				s->isr[v].count, (unsigned long long)s->isr[v].min, (unsigned long long)s->isr[v].max, (double)s->isr[v].total / s->isr[v].count);
+			first = 0;
+		}
+
+		fprintf(file, "}}%s\n", (i + 1 < scenario_total) ? "," : "");
+	}
+
+	fprintf(file, "  ]\n");
+	fprintf(file, "}\n");
+}
+
+int main(int argc, char **argv)
+{
+	elf_firmware_t firmware;
+	const char *output = NULL;
+	FILE *file = stdout;
+	avr_t *avr;
+	int state;
+
+	for (int i = 2; i < argc; i++)
+	{
+		if (!strcmp(argv[i], "-o") && i + 1 < argc)
+		{
+			output = argv[++i];
+		}
+		else
+		{
+			argc = 0;
+		}
+	}
+
+	if (argc < 2)
+	{
+		fprintf(stderr, "usage: %s profile_fw.elf [-o result.json]\n", argv[0]);
+		return 1;
+	}
+
+	memset(&firmware, 0, sizeof(firmware));
+
+	if (elf_read_firmware(argv[1], &firmware))
+	{
+		fprintf(stderr, "can not read %s\n", argv[1]);
+		return 1;
+	}
+
+	if (!(avr = avr_make_mcu_by_name("atmega328p")))
+	{
+		fprintf(stderr, "simavr has no atmega328p\n");
+		return 1;
+	}
+
+	avr_init(avr);
+	avr_load_firmware(avr, &firmware);
+	avr->frequency = PROFILE_FREQUENCY;
+	avr->vcc = avr->avcc = avr->aref = 5000;
+
+	avr_register_io_write(avr, PROFILE_GPIOR0, gpior0_write, NULL);
+	avr_register_io_write(avr, PROFILE_GPIOR1, gpior1_write, NULL);
+	avr_register_io_write(avr, PROFILE_GPIOR2, gpior2_write, NULL);
+
+	//button and encoder A phase idle high, like the pull-ups on board
+	profile_pin(avr, 'D', 2, 1);
+	profile_pin(avr, 'D', 3, 1);
+	avr_raise_irq(avr_io_getirq(avr, AVR_IOCTL_ADC_GETIRQ, ADC_IRQ_ADC6), 5000);
+
+	do
+	{
+		state = avr_run(avr);
+		profile_step(avr);
+	}
+	while (!done && state != cpu_Done && state != cpu_Crashed && avr->cycle < (avr_cycle_count_t)PROFILE_TIMEOUT_S * PROFILE_FREQUENCY);
+
+	if (output && !(file = fopen(output, "w")))
+	{
+		fprintf(stderr, "can not write %s\n", output);
+		return 1;
+	}
+
+	profile_print(file);
+
+	if (output)
+	{
+		fclose(file);
+	}
+
+	return done ? 0 : 1;
+}
+
+
+/*
+ * @release note
+ * | v1.0 2026-10-16 - 3lectron3ats : Initial Release
+ * #
+*/
@@ -0,0 +1,156 @@
+/**
+  * @file      bit_bench.cpp
+  * @version   v1.0
+  * @author    3lectron3ats <3lectron3ats@gmail.com>
+  * @date      2026.10.16
+  * @brief     Host tool, check MatrixBit and time it against the loops it replaced.
+  * @copyright GPL v3.0
+  * *************************************************************************************
+  * @attention
+  * <h2><center>&copy; COPYRIGHT 2023 3lectron3ats </center></h2>
+  * *************************************************************************************
+  * @note
+  *   Every 16-bit map is checked, then each function runs over all 512 boards many
+  *   times. Old ways are copied here as they were: Kernighan's loop on uint32_t for
+  *   popcount, a shift loop for the lowest element and popcount == 9 for full board.
+  *   MatrixBit::count is the nibble table, or __builtin_popcount when built with popcnt
+  *   (-mpopcnt or -march=native). For cycles on AVR itself see extras/simavr, profile_fw
+  *   runs the same set.
+  *   Build and run:
+  *       g++ -O2 -fpermissive -w -DARDUINO=100 -DEE33_HOST_BUILD -Iextras/host -Isrc
+  *           -o bit_bench extras/tools/bit_bench.cpp src/EE33_Matrix.cpp
+  *       ./bit_bench
+  */
+
+#include <EE33_Tic_Tac_Toe.h>
+#include <EE33_Matrix.h>
+
+#define BENCH_ROUND  20000
+
+static const uint8_t nibble_count[16] = {0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4};
+
+/** sink of results, so no call is taken away */
+static volatile uint32_t bench_sink;
+
+__attribute__((noinline)) static uint8_t kernighan_count(uint32_t n)
+{
+	uint8_t count = 0;
+
+	while (n)
+	{
+		n &= (n - 1);
+		count++;
+	}
+
+	return count;
+}
+
+__attribute__((noinline)) static uint8_t nibble_table_count(uint16_t map)
+{
+	uint8_t low = (uint8_t)map, high = (uint8_t)(map >> 8);
+
+	return nibble_count[low & 0x0F] + nibble_count[low >> 4] + nibble_count[high & 0x0F] + nibble_count[high >> 4];
+}
+
+__attribute__((noinline)) static uint8_t builtin_count(uint16_t map)
+{
+	return __builtin_popcount(map);
+}
+
+__attribute__((noinline)) static uint8_t matrix_count(uint16_t map)
+{
+	return MatrixBit::count(map);
+}
+
+__attribute__((noinline)) static uint8_t shift_lowest(uint16_t map)
+{
+	uint8_t index;
+
+	for (index = MATRIX_3X3_M11; index < MATRIX_3X3_ELEMENT_TOTAL && !(map & bit(index)); index++);
+
+	return index;
+}
+
+__attribute__((noinline)) static uint8_t matrix_lowest(uint16_t map)
+{
+	return MatrixBit::lowest(map);
+}
+
+__attribute__((noinline)) static uint8_t kernighan_full(uint16_t map)
+{
+	return kernighan_count(map) == MATRIX_3X3_ELEMENT_TOTAL;
+}
+
+__attribute__((noinline)) static uint8_t matrix_full(uint16_t map)
+{
+	T_MATRIX_3X3 friend_map = {map}, enmy_map = {0};
+
+	return MatrixBit::Is_Full(friend_map, enmy_map);
+}
+
+static uint64_t now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void bench(const char *name, uint8_t (*func)(uint16_t))
+{
+	uint64_t start = now_ns();
+	uint32_t sum = 0;
+
+	for (uint32_t round = 0; round < BENCH_ROUND; round++)
+	{
+		for (uint16_t map = 0; map <= MATRIX_3X3_MASK; map++)
+		{
+			sum += func(map);
+		}
+	}
+
+	bench_sink = sum;
+
+	printf("  %-20s %6.2f ns per call\n", name, (double)(now_ns() - start) / BENCH_ROUND / (MATRIX_3X3_MASK + 1));
+}
+
+int main(void)
+{
+	uint32_t mismatch = 0;
+
+	for (uint32_t map = 0; map <= 0xFFFF; map++)
+	{
+		T_MATRIX_3X3 board = {(uint16_t)(map & MATRIX_3X3_MASK)}, none = {0};
+
+		mismatch += (MatrixBit::count(map) != kernighan_count(map)) + (nibble_table_count(map) != kernighan_count(map));
+
+		if (map <= MATRIX_3X3_MASK)
+		{
+			mismatch += (MatrixBit::lowest(map) != shift_lowest(map));
+			mismatch += (MatrixBit::Is_Full(board, none) != (kernighan_count(map) == MATRIX_3X3_ELEMENT_TOTAL));
+		}
+	}
+
+	printf("MatrixBit: all maps checked, %u mismatch\n", mismatch);
+	printf("popcount\n");
+	bench("kernighan uint32_t", kernighan_count);
+	bench("nibble table", nibble_table_count);
+	bench("__builtin_popcount", builtin_count);
+	bench("MatrixBit::count", matrix_count);
+	printf("lowest element\n");
+	bench("shift loop", shift_lowest);
+	bench("MatrixBit::lowest", matrix_lowest);
+	printf("full board\n");
+	bench("popcount == 9", kernighan_full);
+	bench("MatrixBit::Is_Full", matrix_full);
+
+	return mismatch ? 1 : 0;
+}
+
+
+/*
+ * @release note
+ * | v1.0 2026-10-16 - 3lectron3ats : Initial Release
+ * #
+*/
@@ -0,0 +1,163 @@
+/**
+  * @file      board_check.cpp
+  * @version   v1.0
+  * @author    3lectron3ats <3lectron3ats@gmail.com>
+  * @date      2026.10.16
+  * @brief     Host tool, check Board<M,N,K> search and show it on bigger boards.
+  * @copyright GPL v3.0
+  * *************************************************************************************
+  * @attention
+  * <h2><center>&copy; COPYRIGHT 2023 3lectron3ats </center></h2>
+  * *************************************************************************************
+  * @note
+  *   Board<3,3,3> is checked on every position with friend to move and nobody won:
+  *   the move it picks must keep the win/tie/lose result of perfect play.
+  *   Then Board<4,4,4> and Board<5,5,4> play against themselves with a time budget.
+  *   Build and run:
+  *       g++ -O2 -fpermissive -w -DARDUINO=100 -DEE33_HOST_BUILD -Iextras/host -Isrc
+  *           -o board_check extras/tools/board_check.cpp
+  *       ./board_check
+  */
+
+#include <EE33_Tic_Tac_Toe.h>
+#include <EE33_Board.h>
+
+/** result of perfect play for the one to move, 1 win, 0 tie, -1 lose */
+static int8_t solve(Board<3, 3, 3> &board, uint16_t own, uint16_t other)
+{
+	int8_t best = -1;
+
+	for (uint8_t line = 0; line < Board<3, 3, 3>::LINE_TOTAL; line++)
+	{
+		if ((other & board.get_Line(line)) == board.get_Line(line))
+		{
+			return -1;
+		}
+	}
+
+	if ((own | other) == 0x1FF)
+	{
+		return 0;
+	}
+
+	for (uint8_t i = 0; i < Board<3, 3, 3>::CELL_TOTAL && best < 1; i++)
+	{
+		if (!((own | other) & bit(i)))
+		{
+			int8_t result = -solve(board, other, own | bit(i));
+
+			best = (result > best) ? result : best;
+		}
+	}
+
+	return best;
+}
+
+static uint32_t check_3x3(void)
+{
+	Board<3, 3, 3> board;
+	uint32_t checked = 0, mismatch = 0;
+
+	for (uint16_t code = 0; code < 19683; code++)
+	{
+		uint16_t own = 0, other = 0, digits = code;
+
+		for (uint8_t i = 0; i < 9; i++, digits /= 3)
+		{
+			own |= (digits % 3 == 1) ? bit(i) : 0;
+			other |= (digits % 3 == 2) ? bit(i) : 0;
+		}
+
+		//friend to move, game not over
+		if (__builtin_popcount(own) > __builtin_popcount(other) || __builtin_popcount(other) > __builtin_popcount(own) + 1 || (own | other) == 0x1FF)
+		{
+			continue;
+		}
+
+		board.clear();
+
+		for (uint8_t i = 0; i < 9; i++)
+		{
+			if (own & bit(i))
+			{
+				board.set_Cell(i, PLAYER_TYPE_FRIEND);
+			}
+			if (other & bit(i))
+			{
+				board.set_Cell(i, PLAYER_TYPE_ENMY);
+			}
+		}
+
+		if (board.Is_Bingo(PLAYER_TYPE_FRIEND) || board.Is_Bingo(PLAYER_TYPE_ENMY))
+		{
+			continue;
+		}
+
+		uint8_t move = board.BestNextMove(PLAYER_TYPE_FRIEND);
+
+		checked++;
+
+		if (-solve(board, other, own | bit(move)) != solve(board, own, other))
+		{
+			mismatch++;
+			printf("mismatch friend 0x%03X enmy 0x%03X: move %u\n", own, other, move);
+		}
+	}
+
+	printf("Board<3,3,3>: %u positions checked, %u mismatch\n", checked, mismatch);
+
+	return mismatch;
+}
+
+template <uint8_t M, uint8_t N, uint8_t K>
+static void self_play(uint32_t budget_us)
+{
+	Board<M, N, K> board;
+	PLAYER_TYPE player = PLAYER_TYPE_FRIEND;
+	uint8_t moves = 0;
+
+	printf("Board<%u,%u,%u>: %u lines, %u bytes stack, %lu us per move\n", M, N, K, Board<M, N, K>::LINE_TOTAL, Board<M, N, K>::get_SearchStackSize(), (unsigned long)budget_us);
+
+	while (!board.Is_Full())
+	{
+		unsigned long start = micros();
+		uint8_t cell = board.BestNextMove(player, budget_us);
+
+		board.set_Cell(cell, player);
+		moves++;
+
+		printf("  %c r%u c%u, %lu us\n", (player == PLAYER_TYPE_FRIEND) ? 'X' : 'O', cell / N, cell % N, micros() - start);
+
+		if (board.Is_Bingo(player))
+		{
+			printf("  %c wins after %u moves\n", (player == PLAYER_TYPE_FRIEND) ? 'X' : 'O', moves);
+			break;
+		}
+
+		player = (player == PLAYER_TYPE_FRIEND) ? PLAYER_TYPE_ENMY : PLAYER_TYPE_FRIEND;
+	}
+
+	if (!board.Is_Bingo(PLAYER_TYPE_FRIEND) && !board.Is_Bingo(PLAYER_TYPE_ENMY))
+	{
+		printf("  tie after %u moves\n", moves);
+	}
+
+	printf("  %u nodes\n", board.get_SearchNode());
+}
+
+int main(void)
+{
+	uint32_t mismatch = check_3x3();
+
+	self_play<4, 4, 4>(100000);
+	self_play<5, 5, 4>(100000);
+
+	return mismatch ? 1 : 0;
+}
+
+
+/*
+ * @release note
+ * | v1.0 2026-10-16 - 3lectron3ats : Initial Release
+ * #
+*/
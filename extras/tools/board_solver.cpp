@@ -0,0 +1,888 @@
+/**
+  * @file      board_solver.cpp
+  * @version   v1.0
+  * @author    3lectron3ats <3lectron3ats@gmail.com>
+  * @date      2026.10.16
+  * @brief     Host tool, multi-thread solver of m,n,k boards with work stealing.
+  * @copyright GPL v3.0
+  * *************************************************************************************
+  * @attention
+  * <h2><center>&copy; COPYRIGHT 2023 3lectron3ats </center></h2>
+  * *************************************************************************************
+  * @note
+  *   Lines and bitmaps come from Board<M,N,K>(EE33_Board.h). The game tree is split
+  *   into tasks down to the split ply, every thread keeps its own task deque, takes
+  *   the newest task of its own, and steals the oldest task of another thread when
+  *   it runs out. Tasks below the split ply are solved by one thread with alpha-beta.
+  *   A child that wins for its parent cancels the rest of the siblings.
+  *   All threads share one transposition table without lock(SolverTable), 2^20 buckets
+  *   of 64 bytes by default.
+  *   Value is in view of the first player: 1 win, 0 tie, -1 lose.
+  *   Opening book(-b) keeps the best moves of every position within some plies from
+  *   the empty board, as sorted key and move arrays in flash. The sketch includes the
+  *   generated file and hands the arrays to Board::set_Book, BestNextMove of Board and
+  *   MctsBoard then plays those positions without search.
+  *   Build and run:
+  *       g++ -O2 -std=c++17 -pthread -fpermissive -w -DARDUINO=100 -DEE33_HOST_BUILD
+  *           -Iextras/host -Isrc -o board_solver extras/tools/board_solver.cpp
+  *       ./board_solver 444                   solve 4x4, 4 in a row, all cores(about 1 s)
+  *       ./board_solver 444 -t 8 -s 5         8 threads, split tree down to ply 5
+  *       ./board_solver 444 --scaling         1, 2, 4 ... threads, speedup and efficiency
+  *       ./board_solver 443 -b 2 book.h       opening book of the first 2 plies
+  *       ./board_solver 444 -m 0              no transposition table(-m 22: 2^22 buckets)
+  *       ./board_solver 444 --table-bench -t 16   table probes/s and collisions, 1 ... 16 threads
+  *   Variant is one of 333, 443, 444, 554.
+  */
+
+#include <EE33_Tic_Tac_Toe.h>
+#include <EE33_Board.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+typedef enum
+{
+	SOLVER_BOUND_EXACT = 0,           /*!< value is exact */
+	SOLVER_BOUND_LOWER,               /*!< value is at least */
+	SOLVER_BOUND_UPPER,               /*!< value is at most */
+} SOLVER_BOUND;
+
+#define SOLVER_TABLE_WAY     8        /*!< entries of one bucket */
+#define SOLVER_TABLE_KEY_BIT 54       /*!< bits of the key kept in an entry */
+
+/**
+ * Transposition table shared by all threads without lock.
+ * Key is friend(the one to move) | enmy << CELL_TOTAL, at most SOLVER_TABLE_KEY_BIT bits.
+ * Every entry is one 64-bit word with the whole key in it, written by one compare and
+ * swap, so a reader sees the entry of one writer or the old one, never a mix.
+ *   bit 0-1 value + 1, bit 2-3 bound, bit 4 valid, bit 5-9 draft, bit 10-63 key
+ * A bucket of SOLVER_TABLE_WAY entries fills one cache line.
+ */
+class SolverTable
+{
+public:
+
+	SolverTable(uint8_t size_log2) : shift(64 - size_log2), bucket(new T_BUCKET[(size_t)1 << size_log2])
+	{
+		for (size_t i = 0; i < ((size_t)1 << size_log2); i++)
+		{
+			for (uint8_t way = 0; way < SOLVER_TABLE_WAY; way++)
+			{
+				bucket[i].entry[way].store(0, std::memory_order_relaxed);
+			}
+		}
+	}
+
+	bool probe(uint64_t key, int8_t *value, SOLVER_BOUND *bound)
+	{
+		T_BUCKET *p_bucket = &bucket[_index(key)];
+
+		for (uint8_t way = 0; way < SOLVER_TABLE_WAY; way++)
+		{
+			uint64_t entry = p_bucket->entry[way].load(std::memory_order_relaxed);
+
+			if ((entry & TABLE_VALID) && (entry >> TABLE_KEY_SHIFT) == key)
+			{
+				*value = (int8_t)(entry & 0x03) - 1;
+				*bound = (SOLVER_BOUND)((entry >> 2) & 0x03);
+
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	/** @return true if an entry of another key is replaced */
+	bool store(uint64_t key, int8_t value, SOLVER_BOUND bound, uint8_t draft)
+	{
+		T_BUCKET *p_bucket = &bucket[_index(key)];
+		uint64_t entry = (key << TABLE_KEY_SHIFT) | ((uint64_t)(draft & TABLE_DRAFT_MAX) << 5) | TABLE_VALID | ((uint64_t)bound << 2) | (uint64_t)(value + 1);
+		uint8_t victim = 0, victim_draft = 0xFF;
+
+		for (uint8_t way = 0; way < SOLVER_TABLE_WAY; way++)
+		{
+			uint64_t old = p_bucket->entry[way].load(std::memory_order_relaxed);
+
+			if (!(old & TABLE_VALID) || (old >> TABLE_KEY_SHIFT) == key)
+			{
+				victim = way;
+				victim_draft = 0;
+				break;
+			}
+
+			//keep the entries of bigger subtree
+			if (_draft(old) < victim_draft)
+			{
+				victim = way;
+				victim_draft = _draft(old);
+			}
+		}
+
+		uint64_t old = p_bucket->entry[victim].load(std::memory_order_relaxed);
+
+		//another thread writes this entry now, give it up
+		if (!p_bucket->entry[victim].compare_exchange_strong(old, entry, std::memory_order_relaxed))
+		{
+			return false;
+		}
+
+		return victim_draft != 0;
+	}
+
+private:
+
+	static const uint64_t TABLE_VALID = 0x10;
+	static const uint8_t TABLE_DRAFT_MAX = 0x1F;
+	static const uint8_t TABLE_KEY_SHIFT = 64 - SOLVER_TABLE_KEY_BIT;
+
+	typedef struct alignas(64)
+	{
+		std::atomic<uint64_t> entry[SOLVER_TABLE_WAY];
+	} T_BUCKET;
+
+	size_t _index(uint64_t key)
+	{
+		return (size_t)((key * 0x9E3779B97F4A7C15ULL) >> shift);
+	}
+
+	static uint8_t _draft(uint64_t entry)
+	{
+		return (uint8_t)(entry >> 5) & TABLE_DRAFT_MAX;
+	}
+
+	uint8_t shift;
+	std::unique_ptr<T_BUCKET[]> bucket;
+};
+
+template <uint8_t M, uint8_t N, uint8_t K>
+class Solver
+{
+public:
+
+	typedef typename Board<M, N, K>::T_BITMAP T_BITMAP;
+
+	static const uint8_t CELL_TOTAL = Board<M, N, K>::CELL_TOTAL;
+	static const uint8_t LINE_TOTAL = Board<M, N, K>::LINE_TOTAL;
+
+	static_assert(2 * CELL_TOTAL <= SOLVER_TABLE_KEY_BIT, "key of the board does not fit in a SolverTable entry");
+
+	Solver(unsigned threads, uint8_t split, SolverTable *table = NULL) : thread_total(threads), split_ply(split), table(table)
+	{
+		Board<M, N, K> board;
+		uint8_t weight[CELL_TOTAL] = {0};
+
+		for (uint8_t line = 0; line < LINE_TOTAL; line++)
+		{
+			line_mask[line] = board.get_Line(line);
+
+			for (uint8_t i = 0; i < CELL_TOTAL; i++)
+			{
+				weight[i] += (line_mask[line] & _bit(i)) ? 1 : 0;
+			}
+		}
+
+		//cells on more lines first
+		for (uint8_t i = 0; i < CELL_TOTAL; i++)
+		{
+			move_order[i] = i;
+		}
+
+		for (uint8_t i = 1; i < CELL_TOTAL; i++)
+		{
+			for (uint8_t j = i; j > 0 && weight[move_order[j]] > weight[move_order[j - 1]]; j--)
+			{
+				std::swap(move_order[j], move_order[j - 1]);
+			}
+		}
+	}
+
+	/** solve position, value in view of own(the one to move) */
+	int8_t solve(T_BITMAP own, T_BITMAP other)
+	{
+		std::vector<std::thread> workers;
+
+		queue.clear();
+		arena.clear();
+		counter.clear();
+
+		for (unsigned i = 0; i < thread_total; i++)
+		{
+			queue.emplace_back(new T_QUEUE);
+			arena.emplace_back(new std::vector<std::unique_ptr<T_TASK> >);
+			counter.emplace_back(new T_COUNTER);
+		}
+
+		done = false;
+
+		T_TASK *root = _new_task(0, own, other, NULL, 0);
+		queue[0]->tasks.push_back(root);
+
+		for (unsigned i = 0; i < thread_total; i++)
+		{
+			workers.emplace_back(&Solver::_worker, this, i);
+		}
+
+		for (unsigned i = 0; i < thread_total; i++)
+		{
+			workers[i].join();
+		}
+
+		return root_value;
+	}
+
+	uint64_t get_Node(void)
+	{
+		uint64_t total = 0;
+
+		for (unsigned i = 0; i < counter.size(); i++)
+		{
+			total += counter[i]->node;
+		}
+
+		return total;
+	}
+
+	uint64_t get_Hit(void)
+	{
+		uint64_t total = 0;
+
+		for (unsigned i = 0; i < counter.size(); i++)
+		{
+			total += counter[i]->hit;
+		}
+
+		return total;
+	}
+
+	uint64_t get_Steal(void)
+	{
+		uint64_t total = 0;
+
+		for (unsigned i = 0; i < counter.size(); i++)
+		{
+			total += counter[i]->steal;
+		}
+
+		return total;
+	}
+
+	T_BITMAP full(void)
+	{
+		return (T_BITMAP)((T_BITMAP)~(T_BITMAP)0 >> (sizeof(T_BITMAP) * 8 - CELL_TOTAL));
+	}
+
+	/** empty cells which make a line of the player at once */
+	T_BITMAP threats(T_BITMAP player, T_BITMAP empty)
+	{
+		T_BITMAP result = 0;
+
+		for (uint8_t line = 0; line < LINE_TOTAL; line++)
+		{
+			T_BITMAP hole = line_mask[line] & empty;
+
+			if (__builtin_popcountll((uint64_t)(player & line_mask[line])) == K - 1 && hole && !(hole & (hole - 1)))
+			{
+				result |= hole;
+			}
+		}
+
+		return result;
+	}
+
+	bool Is_Bingo(T_BITMAP player)
+	{
+		for (uint8_t line = 0; line < LINE_TOTAL; line++)
+		{
+			if ((player & line_mask[line]) == line_mask[line])
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+private:
+
+	typedef struct T_TASK
+	{
+		T_BITMAP own;
+		T_BITMAP other;
+		T_TASK *parent;
+		uint8_t ply;
+		std::atomic<int> pending;      /*!< children not finished */
+		std::atomic<int> best;         /*!< best value of finished children */
+		std::atomic<bool> cut;         /*!< value is known, skip the rest */
+	} T_TASK;
+
+	typedef struct
+	{
+		std::mutex lock;
+		std::deque<T_TASK *> tasks;
+	} T_QUEUE;
+
+	typedef struct
+	{
+		uint64_t node = 0;
+		uint64_t steal = 0;
+		uint64_t hit = 0;
+		char pad[40];                  /*!< keep counters of threads in different cache lines */
+	} T_COUNTER;
+
+	static T_BITMAP _bit(uint8_t cell)
+	{
+		return (T_BITMAP)1 << cell;
+	}
+
+	T_TASK *_new_task(unsigned id, T_BITMAP own, T_BITMAP other, T_TASK *parent, uint8_t ply)
+	{
+		T_TASK *task = new T_TASK;
+
+		task->own = own;
+		task->other = other;
+		task->parent = parent;
+		task->ply = ply;
+		task->pending = 0;
+		task->best = -1;
+		task->cut = false;
+
+		arena[id]->emplace_back(task);
+
+		return task;
+	}
+
+	/** moves worth trying, value is set if known without search */
+	T_BITMAP _moves(T_BITMAP own, T_BITMAP other, int8_t *value)
+	{
+		T_BITMAP empty = ~(own | other) & full();
+		T_BITMAP block;
+
+		if (!empty)
+		{
+			*value = 0;
+			return 0;
+		}
+
+		if (threats(own, empty))
+		{
+			*value = 1;
+			return 0;
+		}
+
+		block = threats(other, empty);
+
+		if (block & (block - 1))
+		{
+			*value = -1;  //can not block two
+			return 0;
+		}
+
+		return block ? block : empty;
+	}
+
+	int8_t _search(T_BITMAP own, T_BITMAP other, int8_t alpha, int8_t beta, T_COUNTER *stats)
+	{
+		int8_t best = -1, value, origin = alpha;
+		uint64_t key = (uint64_t)own | ((uint64_t)other << CELL_TOTAL);
+		SOLVER_BOUND bound;
+		T_BITMAP moves;
+
+		stats->node++;
+
+		moves = _moves(own, other, &value);
+
+		if (!moves)
+		{
+			return value;
+		}
+
+		if (table && table->probe(key, &value, &bound))
+		{
+			stats->hit++;
+
+			if (bound == SOLVER_BOUND_EXACT || (bound == SOLVER_BOUND_LOWER && value >= beta) || (bound == SOLVER_BOUND_UPPER && value <= alpha))
+			{
+				return value;
+			}
+		}
+
+		for (uint8_t i = 0; i < CELL_TOTAL && alpha < beta; i++)
+		{
+			if (moves & _bit(move_order[i]))
+			{
+				value = -_search(other, own | _bit(move_order[i]), -beta, -alpha, stats);
+
+				best = (value > best) ? value : best;
+				alpha = (value > alpha) ? value : alpha;
+			}
+		}
+
+		if (table)
+		{
+			bound = (best <= origin) ? SOLVER_BOUND_UPPER : (best >= beta) ? SOLVER_BOUND_LOWER : SOLVER_BOUND_EXACT;
+			table->store(key, best, bound, CELL_TOTAL - __builtin_popcountll((uint64_t)(own | other)));
+		}
+
+		return best;
+	}
+
+	bool _cancelled(T_TASK *task)
+	{
+		for (T_TASK *p = task->parent; p; p = p->parent)
+		{
+			if (p->cut)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void _finish(T_TASK *task, int8_t value)
+	{
+		T_TASK *parent = task->parent;
+
+		if (!parent)
+		{
+			root_value = value;
+			done = true;
+			return;
+		}
+
+		int child = -value;
+		int best = parent->best;
+
+		while (child > best && !parent->best.compare_exchange_weak(best, child));
+
+		if (child == 1)
+		{
+			parent->cut = true;  //nothing beats a win
+		}
+
+		if (--parent->pending == 0)
+		{
+			_finish(parent, parent->best);
+		}
+	}
+
+	void _run(unsigned id, T_TASK *task)
+	{
+		int8_t value = 0;
+
+		if (_cancelled(task))
+		{
+			_finish(task, 0);  //parent does not need the value
+			return;
+		}
+
+		if (task->ply >= split_ply)
+		{
+			_finish(task, _search(task->own, task->other, -1, 1, counter[id].get()));
+			return;
+		}
+
+		counter[id]->node++;
+
+		T_BITMAP moves = _moves(task->own, task->other, &value);
+
+		if (!moves)
+		{
+			_finish(task, value);
+			return;
+		}
+
+		std::vector<T_TASK *> children;
+
+		for (uint8_t i = 0; i < CELL_TOTAL; i++)
+		{
+			if (moves & _bit(move_order[i]))
+			{
+				children.push_back(_new_task(id, task->other, task->own | _bit(move_order[i]), task, task->ply + 1));
+			}
+		}
+
+		task->pending = children.size();
+
+		std::lock_guard<std::mutex> guard(queue[id]->lock);
+
+		//owner takes from back, so the best ordered child goes last
+		for (int i = children.size() - 1; i >= 0; i--)
+		{
+			queue[id]->tasks.push_back(children[i]);
+		}
+	}
+
+	T_TASK *_take(unsigned id)
+	{
+		{
+			std::lock_guard<std::mutex> guard(queue[id]->lock);
+
+			if (!queue[id]->tasks.empty())
+			{
+				T_TASK *task = queue[id]->tasks.back();
+
+				queue[id]->tasks.pop_back();
+
+				return task;
+			}
+		}
+
+		//steal the oldest task, it is near the root and has the most work
+		for (unsigned i = 1; i < thread_total; i++)
+		{
+			unsigned victim = (id + i) % thread_total;
+			std::lock_guard<std::mutex> guard(queue[victim]->lock);
+
+			if (!queue[victim]->tasks.empty())
+			{
+				T_TASK *task = queue[victim]->tasks.front();
+
+				queue[victim]->tasks.pop_front();
+				counter[id]->steal++;
+
+				return task;
+			}
+		}
+
+		return NULL;
+	}
+
+	void _worker(unsigned id)
+	{
+		while (!done)
+		{
+			T_TASK *task = _take(id);
+
+			if (task)
+			{
+				_run(id, task);
+			}
+			else
+			{
+				std::this_thread::yield();
+			}
+		}
+	}
+
+	unsigned thread_total;
+	uint8_t split_ply;
+	SolverTable *table;
+	T_BITMAP line_mask[LINE_TOTAL];
+	uint8_t move_order[CELL_TOTAL];
+
+	std::vector<std::unique_ptr<T_QUEUE> > queue;
+	std::vector<std::unique_ptr<std::vector<std::unique_ptr<T_TASK> > > > arena;
+	std::vector<std::unique_ptr<T_COUNTER> > counter;
+
+	std::atomic<bool> done;
+	int8_t root_value;
+};
+
+static const char *value_name(int8_t value)
+{
+	return (value > 0) ? "first player wins" : (value < 0) ? "second player wins" : "tie";
+}
+
+template <uint8_t M, uint8_t N, uint8_t K>
+static double run_solve(unsigned threads, uint8_t split, uint8_t table_log2, bool quiet)
+{
+	std::unique_ptr<SolverTable> table(table_log2 ? new SolverTable(table_log2) : NULL);
+	Solver<M, N, K> solver(threads, split, table.get());
+	auto start = std::chrono::steady_clock::now();
+	int8_t value = solver.solve(0, 0);
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	if (!quiet)
+	{
+		printf("Board<%u,%u,%u>: %s\n", M, N, K, value_name(value));
+		printf("  %u threads, split ply %u, %llu positions, %.3f s, %.0f positions/s, %llu steals, %llu table hits\n", threads, split,
+		       (unsigned long long)solver.get_Node(), seconds, solver.get_Node() / seconds, (unsigned long long)solver.get_Steal(),
+		       (unsigned long long)solver.get_Hit());
+	}
+	else
+	{
+		printf("  %2u threads: %.3f s, %.0f positions/s, %s\n", threads, seconds, solver.get_Node() / seconds, value_name(value));
+	}
+
+	return seconds;
+}
+
+template <uint8_t M, uint8_t N, uint8_t K>
+static void run_scaling(unsigned threads, uint8_t split, uint8_t table_log2)
+{
+	double base = 0;
+
+	printf("Board<%u,%u,%u> scaling, split ply %u\n", M, N, K, split);
+
+	for (unsigned t = 1; t <= threads; t *= 2)
+	{
+		double seconds = run_solve<M, N, K>(t, split, table_log2, true);
+
+		base = (t == 1) ? seconds : base;
+		printf("             speedup %.2f, efficiency %.0f%%\n", base / seconds, 100 * base / seconds / t);
+	}
+}
+
+template <uint8_t M, uint8_t N, uint8_t K>
+static void run_book(unsigned threads, uint8_t split, uint8_t table_log2, uint8_t plies, const char *path)
+{
+	typedef typename Solver<M, N, K>::T_BITMAP T_BITMAP;
+
+	std::unique_ptr<SolverTable> table(table_log2 ? new SolverTable(table_log2) : NULL);
+	Solver<M, N, K> solver(threads, split, table.get());
+	std::vector<std::pair<uint64_t, T_BITMAP> > book;
+	std::vector<std::pair<T_BITMAP, T_BITMAP> > level(1, std::make_pair((T_BITMAP)0, (T_BITMAP)0));
+
+	for (uint8_t ply = 0; ply < plies; ply++)
+	{
+		std::vector<std::pair<T_BITMAP, T_BITMAP> > next;
+
+		for (auto &position : level)
+		{
+			T_BITMAP own = position.first, other = position.second;
+			T_BITMAP empty = ~(own | other) & solver.full();
+			T_BITMAP best_moves = 0;
+			int8_t best = -2;
+
+			for (uint8_t i = 0; i < Solver<M, N, K>::CELL_TOTAL; i++)
+			{
+				T_BITMAP move = (T_BITMAP)1 << i;
+
+				if (!(empty & move))
+				{
+					continue;
+				}
+
+				int8_t value = solver.Is_Bingo(own | move) ? 1 : -solver.solve(other, own | move);
+
+				best_moves = (value > best) ? move : (value == best) ? best_moves | move : best_moves;
+				best = (value > best) ? value : best;
+
+				if (!solver.Is_Bingo(own | move) && ((own | other | move) != solver.full()))
+				{
+					next.push_back(std::make_pair(other, own | move));
+				}
+			}
+
+			book.push_back(std::make_pair((uint64_t)own | ((uint64_t)other << Solver<M, N, K>::CELL_TOTAL), best_moves));
+		}
+
+		std::sort(next.begin(), next.end());
+		next.erase(std::unique(next.begin(), next.end()), next.end());
+		level.swap(next);
+		printf("  ply %u done, %zu positions\n", ply, book.size());
+	}
+
+	std::sort(book.begin(), book.end());
+	book.erase(std::unique(book.begin(), book.end()), book.end());
+
+	FILE *file = fopen(path, "w");
+	size_t key_size = sizeof(typename Board<M, N, K>::T_BOOK_KEY);
+	const char *key_type = (key_size == 2) ? "uint16_t" : (key_size == 4) ? "uint32_t" : "uint64_t";
+	const char *move_type = (sizeof(T_BITMAP) == 2) ? "uint16_t" : (sizeof(T_BITMAP) == 4) ? "uint32_t" : "uint64_t";
+
+	fprintf(file, "/* generated by extras/tools/board_solver.cpp, Board<%u,%u,%u>, %u plies, do not edit */\n", M, N, K, plies);
+	fprintf(file, "/* board.set_Book(book_%ux%ux%u_key, book_%ux%ux%u_move, BOOK_%uX%uX%u_SIZE); */\n\n", M, N, K, M, N, K, M, N, K);
+	fprintf(file, "#define BOOK_%uX%uX%u_SIZE  %zu\n\n", M, N, K, book.size());
+	fprintf(file, "/** friend(the one to move) | enmy << %u, sorted */\n", Solver<M, N, K>::CELL_TOTAL);
+	fprintf(file, "const %s book_%ux%ux%u_key[BOOK_%uX%uX%u_SIZE] PROGMEM =\n{\n", key_type, M, N, K, M, N, K);
+
+	for (size_t i = 0; i < book.size(); i++)
+	{
+		fprintf(file, "%s0x%llX,%s", (i % 8) ? " " : "\t", (unsigned long long)book[i].first, (i % 8 == 7 || i + 1 == book.size()) ? "\n" : "");
+	}
+
+	fprintf(file, "};\n\n/** best moves of friend, bit n is cell n */\n");
+	fprintf(file, "const %s book_%ux%ux%u_move[BOOK_%uX%uX%u_SIZE] PROGMEM =\n{\n", move_type, M, N, K, M, N, K);
+
+	for (size_t i = 0; i < book.size(); i++)
+	{
+		fprintf(file, "%s0x%llX,%s", (i % 8) ? " " : "\t", (unsigned long long)book[i].second, (i % 8 == 7 || i + 1 == book.size()) ? "\n" : "");
+	}
+
+	fprintf(file, "};\n");
+	fclose(file);
+
+	printf("Board<%u,%u,%u>: %zu book positions written to %s\n", M, N, K, book.size(), path);
+}
+
+/** random positions from every thread, probe and store on miss like the solver does */
+template <uint8_t M, uint8_t N, uint8_t K>
+static void run_table_bench(unsigned threads, uint8_t table_log2)
+{
+	const uint32_t PROBE_TOTAL = 1UL << 21;
+
+	printf("Board<%u,%u,%u> table, %u buckets of %u entries, %u probes per thread\n", M, N, K, 1U << table_log2, SOLVER_TABLE_WAY, PROBE_TOTAL);
+
+	for (unsigned t = 1; t <= threads; t *= 2)
+	{
+		SolverTable table(table_log2);
+		std::vector<std::thread> workers;
+		std::atomic<uint64_t> hit(0), store(0), replace(0);
+		auto start = std::chrono::steady_clock::now();
+
+		for (unsigned id = 0; id < t; id++)
+		{
+			workers.emplace_back([&, id]()
+			{
+				uint64_t seed = id, my_hit = 0, my_store = 0, my_replace = 0;
+
+				for (uint32_t n = 0; n < PROBE_TOTAL; n++)
+				{
+					uint64_t own = 0, other = 0;
+					uint8_t pieces;
+					int8_t value;
+					SOLVER_BOUND bound;
+
+					//few pieces are more likely like in a search near the root
+					seed = seed * 0x5851F42D4C957F2DULL + 1442695040888963407ULL;
+					pieces = ((seed >> 33) % (M * N + 1)) * ((seed >> 45) % (M * N + 1)) / (M * N);
+
+					for (uint8_t i = 0; i < pieces; i++)
+					{
+						uint8_t cell;
+
+						seed = seed * 0x5851F42D4C957F2DULL + 1442695040888963407ULL;
+						cell = (seed >> 33) % (M * N);
+
+						while ((own | other) & (1ULL << cell))
+						{
+							cell = (cell + 1) % (M * N);
+						}
+
+						(i & 1) ? (other |= 1ULL << cell) : (own |= 1ULL << cell);
+					}
+
+					uint64_t key = (pieces & 1) ? (other | (own << (M * N))) : (own | (other << (M * N)));
+
+					if (table.probe(key, &value, &bound))
+					{
+						my_hit++;
+					}
+					else
+					{
+						my_store++;
+						my_replace += table.store(key, 0, SOLVER_BOUND_EXACT, M * N - pieces) ? 1 : 0;
+					}
+				}
+
+				hit += my_hit;
+				store += my_store;
+				replace += my_replace;
+			});
+		}
+
+		for (auto &worker : workers)
+		{
+			worker.join();
+		}
+
+		double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+		printf("  %2u threads: %.0f probes/s, hit %.1f%%, collision %.1f%% of stores\n", t, (double)t * PROBE_TOTAL / seconds,
+		       100.0 * hit / ((double)t * PROBE_TOTAL), store ? 100.0 * replace / store : 0.0);
+	}
+}
+
+template <uint8_t M, uint8_t N, uint8_t K>
+static void run(unsigned threads, uint8_t split, uint8_t table_log2, bool scaling, bool table_bench, uint8_t plies, const char *path)
+{
+	if (table_bench)
+	{
+		run_table_bench<M, N, K>(threads, table_log2 ? table_log2 : 16);
+	}
+	else if (path)
+	{
+		run_book<M, N, K>(threads, split, table_log2, plies, path);
+	}
+	else if (scaling)
+	{
+		run_scaling<M, N, K>(threads, split, table_log2);
+	}
+	else
+	{
+		run_solve<M, N, K>(threads, split, table_log2, false);
+	}
+}
+
+int main(int argc, char **argv)
+{
+	std::string variant = (argc > 1) ? argv[1] : "444";
+	unsigned threads = std::thread::hardware_concurrency();
+	uint8_t split = 4, plies = 0, table_log2 = 20;
+	bool scaling = false, table_bench = false;
+	const char *path = NULL;
+
+	for (int i = 2; i < argc; i++)
+	{
+		std::string arg = argv[i];
+
+		if (arg == "-t" && i + 1 < argc)
+		{
+			threads = atoi(argv[++i]);
+		}
+		else if (arg == "-s" && i + 1 < argc)
+		{
+			split = atoi(argv[++i]);
+		}
+		else if (arg == "-b" && i + 2 < argc)
+		{
+			plies = atoi(argv[++i]);
+			path = argv[++i];
+		}
+		else if (arg == "-m" && i + 1 < argc)
+		{
+			table_log2 = atoi(argv[++i]);
+		}
+		else if (arg == "--scaling")
+		{
+			scaling = true;
+		}
+		else if (arg == "--table-bench")
+		{
+			table_bench = true;
+		}
+	}
+
+	threads = threads ? threads : 1;
+
+	if (variant == "333")
+	{
+		run<3, 3, 3>(threads, split, table_log2, scaling, table_bench, plies, path);
+	}
+	else if (variant == "443")
+	{
+		run<4, 4, 3>(threads, split, table_log2, scaling, table_bench, plies, path);
+	}
+	else if (variant == "444")
+	{
+		run<4, 4, 4>(threads, split, table_log2, scaling, table_bench, plies, path);
+	}
+	else if (variant == "554")
+	{
+		run<5, 5, 4>(threads, split, table_log2, scaling, table_bench, plies, path);
+	}
+	else
+	{
+		printf("unknown variant %s, use 333, 443, 444 or 554\n", variant.c_str());
+		return 1;
+	}
+
+	return 0;
+}
+
+
+/*
+ * @release note
+ * | v1.0 2026-10-16 - 3lectron3ats : Initial Release
+ * #
+*/
@@ -0,0 +1,219 @@
+/**
+  * @file      engine_bench.cpp
+  * @version   v1.0
+  * @author    3lectron3ats <3lectron3ats@gmail.com>
+  * @date      2026.10.16
+  * @brief     Host tool, benchmark LED_SQUARE::BestNextMove on every reachable position.
+  * @copyright GPL v3.0
+  * *************************************************************************************
+  * @attention
+  * <h2><center>&copy; COPYRIGHT 2023 3lectron3ats </center></h2>
+  * *************************************************************************************
+  * @note
+  *   Every position of a real game with the mover not decided yet is set on the LEDs,
+  *   once with color A to move and once with color B, and BestNextMove is timed.
+  *   Cache is flushed before each call and positions always go in the same order, so
+  *   node counts only change when the search changes; killer and history moves still
+  *   carry over from call to call, so -r and --order give other counts. Output is one
+  *   JSON object, so results of two commits can be compared by a script.
+  *   Build and run:
+  *       g++ -O2 -fpermissive -w -DARDUINO=100 -DEE33_HOST_BUILD -Iextras/host -Isrc
+  *           -o engine_bench extras/tools/engine_bench.cpp
+  *           src/EE33_LED.cpp src/EE33_Minmax.cpp src/EE33_SimpleQueue.cpp src/EE33_MoveTable.cpp
+  *           src/EE33_Symmetry.cpp src/EE33_MinmaxCache.cpp src/EE33_Matrix.cpp
+  *           src/EE33_RetroTable.cpp
+  *       ./engine_bench [-b budget_us] [-r repeat] [--order index] [-o result.json]
+  */
+
+#include <EE33_Tic_Tac_Toe.h>
+#include <EE33_LED.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+
+#define BENCH_POSITION_MAX  (2 * 19683)
+
+byte player_A_pin[LED_SEQ_TOTAL] = {0,4,6,8,10,12,A0,A2,A4};
+byte player_B_pin[LED_SEQ_TOTAL] = {1,5,7,9,11,13,A1,A3,A5};
+
+LED_SQUARE led_square(player_A_pin, player_B_pin);
+
+/** latency of every call in nanoseconds */
+static uint64_t latency_ns[BENCH_POSITION_MAX];
+
+static uint64_t now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static bool has_line(uint16_t map)
+{
+	for (uint8_t line = LINE_1; line < LINE_SEQ_TOTAL; line++)
+	{
+		uint16_t mask = MatrixLine::get_LineMask((LINE_SEQUENCE)line);
+
+		if ((map & mask) == mask)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/** position of a real game, the one to move owns own and nobody won yet */
+static bool is_reachable(uint16_t own, uint16_t other)
+{
+	int8_t diff = __builtin_popcount(other) - __builtin_popcount(own);
+
+	return (diff == 0 || diff == 1) && (own | other) != MATRIX_3X3_MASK && !has_line(own) && !has_line(other);
+}
+
+static double percentile(uint32_t total, double rank)
+{
+	uint32_t index = (uint32_t)(rank * (total - 1) + 0.5);
+
+	return latency_ns[index] / 1000.0;
+}
+
+int main(int argc, char **argv)
+{
+	uint32_t budget_us = 0, repeat = 1, total = 0, per_color[LED_COLOR_TOTAL] = {0, 0};
+	MINMAX_MOVE_ORDER order = MINMAX_ORDER_HEURISTIC;
+	const char *output = NULL;
+	uint64_t nodes = 0, cutoffs = 0, elapsed_ns = 0;
+	FILE *file = stdout;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (!strcmp(argv[i], "-b") && i + 1 < argc)
+		{
+			budget_us = strtoul(argv[++i], NULL, 0);
+		}
+		else if (!strcmp(argv[i], "-r") && i + 1 < argc)
+		{
+			repeat = strtoul(argv[++i], NULL, 0);
+			repeat = (repeat) ? repeat : 1;
+		}
+		else if (!strcmp(argv[i], "--order") && i + 1 < argc)
+		{
+			order = (!strcmp(argv[++i], "index")) ? MINMAX_ORDER_INDEX : MINMAX_ORDER_HEURISTIC;
+		}
+		else if (!strcmp(argv[i], "-o") && i + 1 < argc)
+		{
+			output = argv[++i];
+		}
+		else
+		{
+			fprintf(stderr, "usage: %s [-b budget_us] [-r repeat] [--order index|heuristic] [-o result.json]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	randomSeed(1);
+	led_square.begin();
+	led_square.set_MoveOrder(order);
+
+	for (uint8_t color = LED_COLOR_A; color < LED_COLOR_TOTAL; color++)
+	{
+		for (uint16_t code = 0; code < 19683; code++)
+		{
+			uint16_t own = 0, other = 0, digits = code;
+			uint64_t best_ns = ~(uint64_t)0;
+			T_MINMAX_SEARCH_STATS before, after;
+
+			for (uint8_t seq = LED_1; seq < LED_SEQ_TOTAL; seq++, digits /= 3)
+			{
+				own |= (digits % 3 == 1) ? bit(seq) : 0;
+				other |= (digits % 3 == 2) ? bit(seq) : 0;
+			}
+
+			if (!is_reachable(own, other))
+			{
+				continue;
+			}
+
+			led_square.set_allOff();
+
+			for (uint8_t seq = LED_1; seq < LED_SEQ_TOTAL; seq++)
+			{
+				if (own & bit(seq))
+				{
+					led_square.set_LEDStatus(seq, color, LED_STATUS_ON);
+				}
+				if (other & bit(seq))
+				{
+					led_square.set_LEDStatus(seq, COLOR_CYCLE(color), LED_STATUS_ON);
+				}
+			}
+
+			//fastest of the repeats, nodes of the first one
+			for (uint32_t r = 0; r < repeat; r++)
+			{
+				uint64_t start_ns;
+
+				led_square.get_Engine()->flush();
+				led_square.get_SearchStats(&before);
+
+				start_ns = now_ns();
+				led_square.BestNextMove(color, budget_us);
+				start_ns = now_ns() - start_ns;
+
+				led_square.get_SearchStats(&after);
+
+				best_ns = (start_ns < best_ns) ? start_ns : best_ns;
+
+				if (!r)
+				{
+					nodes += after.node - before.node;
+					cutoffs += after.cutoff - before.cutoff;
+				}
+			}
+
+			latency_ns[total++] = best_ns;
+			elapsed_ns += best_ns;
+			per_color[color]++;
+		}
+	}
+
+	std::sort(latency_ns, latency_ns + total);
+
+	if (output && !(file = fopen(output, "w")))
+	{
+		fprintf(stderr, "can not write %s\n", output);
+		return 1;
+	}
+
+	fprintf(file, "{\n");
+	fprintf(file, "  \"tool\": \"engine_bench\",\n");
+	fprintf(file, "  \"budget_us\": %u,\n", budget_us);
+	fprintf(file, "  \"repeat\": %u,\n", repeat);
+	fprintf(file, "  \"move_order\": \"%s\",\n", (order == MINMAX_ORDER_INDEX) ? "index" : "heuristic");
+	fprintf(file, "  \"cache_size\": %u,\n", MINMAX_CACHE_SIZE);
+	fprintf(file, "  \"positions\": {\"color_a\": %u, \"color_b\": %u, \"total\": %u},\n", per_color[LED_COLOR_A], per_color[LED_COLOR_B], total);
+	fprintf(file, "  \"nodes\": %llu,\n", (unsigned long long)nodes);
+	fprintf(file, "  \"cutoffs\": %llu,\n", (unsigned long long)cutoffs);
+	fprintf(file, "  \"elapsed_us\": %.1f,\n", elapsed_ns / 1000.0);
+	fprintf(file, "  \"nodes_per_sec\": %.0f,\n", (elapsed_ns) ? nodes * 1e9 / elapsed_ns : 0.0);
+	fprintf(file, "  \"latency_us\": {\"min\": %.3f, \"p50\": %.3f, \"p90\": %.3f, \"p99\": %.3f, \"max\": %.3f, \"mean\": %.3f}\n",
+		percentile(total, 0), percentile(total, 0.5), percentile(total, 0.9), percentile(total, 0.99), percentile(total, 1), elapsed_ns / 1000.0 / total);
+	fprintf(file, "}\n");
+
+	if (output)
+	{
+		fclose(file);
+	}
+
+	return 0;
+}
+
+
+/*
+ * @release note
+ * | v1.0 2026-10-16 - 3lectron3ats : Initial Release
+ * #
+*/
@@ -0,0 +1,164 @@
+/**
+  * @file      engine_instance_check.cpp
+  * @version   v1.0
+  * @author    3lectron3ats <3lectron3ats@gmail.com>
+  * @date      2026.10.16
+  * @brief     Host tool, check that MinmaxEngine objects play many games side by side.
+  * @copyright GPL v3.0
+  * *************************************************************************************
+  * @attention
+  * <h2><center>&copy; COPYRIGHT 2023 3lectron3ats </center></h2>
+  * *************************************************************************************
+  * @note
+  *   One game for each opening element, each side of a game is its own engine. Games go
+  *   one move at a time in turn, and while a side waits it ponders in 1 us slices, so
+  *   searches and paused ponder stacks of all engines are mixed. Every move must be in
+  *   the set a lone engine chooses from the same position, and every game must end in
+  *   a tie. Any state shared between engines breaks the first or the second.
+  *   Build and run:
+  *       g++ -O2 -fpermissive -w -DARDUINO=100 -DEE33_HOST_BUILD -Iextras/host -Isrc
+  *           -o engine_instance_check extras/tools/engine_instance_check.cpp
+  *           src/EE33_Minmax.cpp src/EE33_MinmaxCache.cpp src/EE33_Matrix.cpp src/EE33_Symmetry.cpp
+  *       ./engine_instance_check
+  */
+
+#include <EE33_Tic_Tac_Toe.h>
+#include <EE33_Minmax.h>
+
+/** one game for each opening element */
+#define CHECK_GAME_TOTAL   MATRIX_3X3_ELEMENT_TOTAL
+
+/** each pass plays all games again with another random seed */
+#define CHECK_PASS_TOTAL   20
+
+/** time of one ponder slice, in microseconds */
+#define CHECK_SLICE_US     1
+
+typedef struct
+{
+	T_MATRIX_3X3 map[2];       /*!< board of each side */
+	uint8_t      turn;         /*!< side to move */
+	bool         over;
+} T_CHECK_GAME;
+
+/** engine of each side of each game */
+MinmaxEngine game_engine[CHECK_GAME_TOTAL][2];
+
+/** engine which searches every position alone */
+MinmaxEngine search_engine;
+
+/** moves BestNextMove can choose */
+static uint16_t choice_set(T_MATRIX_3X3 map_friend, T_MATRIX_3X3 map_enmy)
+{
+	uint16_t moves = 0;
+
+	for (long choose = 0; choose < MATRIX_3X3_ELEMENT_TOTAL; choose++)
+	{
+		MATRIX_3X3_ELEMENT next_step;
+
+		host_random_force() = choose;
+		next_step = search_engine.BestNextMove(map_friend, map_enmy, MatrixHash::hash(map_friend, map_enmy, PLAYER_TYPE_FRIEND), 0);
+
+		moves |= (next_step < MATRIX_3X3_ELEMENT_TOTAL) ? MatrixBit::mask(next_step) : 0;
+	}
+
+	host_random_force() = -1;
+
+	return moves;
+}
+
+int main(void)
+{
+	uint32_t games = 0, ties = 0, moves = 0, pondered = 0, mismatch = 0;
+
+	for (uint8_t pass = 0; pass < CHECK_PASS_TOTAL; pass++)
+	{
+		T_CHECK_GAME game[CHECK_GAME_TOTAL];
+		uint8_t running = CHECK_GAME_TOTAL;
+
+		randomSeed(pass);
+
+		//side 0 opened on element g, side 1 is to move and side 0 ponders
+		for (uint8_t g = 0; g < CHECK_GAME_TOTAL; g++)
+		{
+			game[g].map[0].d16 = MatrixBit::mask(g);
+			game[g].map[1].d16 = 0;
+			game[g].turn = 1;
+			game[g].over = false;
+
+			game_engine[g][0].flush();
+			game_engine[g][1].flush();
+			game_engine[g][0].ponderStart(game[g].map[0], game[g].map[1], MatrixHash::hash(game[g].map[0], game[g].map[1], PLAYER_TYPE_FRIEND));
+		}
+
+		while (running)
+		{
+			for (uint8_t g = 0; g < CHECK_GAME_TOTAL; g++)
+			{
+				T_CHECK_GAME *now = &game[g];
+				MinmaxEngine *mover = &game_engine[g][now->turn];
+				T_MATRIX_3X3 own = now->map[now->turn], other = now->map[!now->turn];
+				T_MINMAX_SEARCH_STATS before, after;
+				MATRIX_3X3_ELEMENT next_step;
+				uint16_t expect;
+
+				if (now->over)
+				{
+					continue;
+				}
+
+				//a slice for the waiting side of every game before anyone moves
+				for (uint8_t w = 0; w < CHECK_GAME_TOTAL; w++)
+				{
+					if (!game[w].over)
+					{
+						game_engine[w][!game[w].turn].ponderRoutine(game[w].map[!game[w].turn], game[w].map[game[w].turn], CHECK_SLICE_US);
+					}
+				}
+
+				expect = choice_set(own, other);
+
+				mover->get_SearchStats(&before);
+				next_step = mover->BestNextMove(own, other, MatrixHash::hash(own, other, PLAYER_TYPE_FRIEND), 0);
+				mover->get_SearchStats(&after);
+
+				moves++;
+				pondered += (after.node == before.node) ? 1 : 0;
+
+				if (next_step >= MATRIX_3X3_ELEMENT_TOTAL || !(expect & MatrixBit::mask(next_step)))
+				{
+					mismatch++;
+					printf("mismatch pass %u game %u own 0x%03X other 0x%03X: move %u, search 0x%03X\n", pass, g, own.d16, other.d16, next_step, expect);
+				}
+
+				now->map[now->turn].d16 |= (next_step < MATRIX_3X3_ELEMENT_TOTAL) ? MatrixBit::mask(next_step) : 0;
+				own = now->map[now->turn];
+
+				if (MatrixLine::Is_Bingo(own) || MatrixBit::Is_Full(own, other) || next_step >= MATRIX_3X3_ELEMENT_TOTAL)
+				{
+					now->over = true;
+					running--;
+					games++;
+					ties += (!MatrixLine::Is_Bingo(own) && !MatrixLine::Is_Bingo(other)) ? 1 : 0;
+					continue;
+				}
+
+				//the side which moved ponders during the other one's turn
+				mover->ponderStart(own, other, MatrixHash::hash(own, other, PLAYER_TYPE_FRIEND));
+				now->turn = !now->turn;
+			}
+		}
+	}
+
+	printf("%u games by %u engines, %u ties, %u moves(%u pondered), %u mismatch\n",
+		games, 2 * CHECK_GAME_TOTAL, ties, moves, pondered, mismatch);
+
+	return (mismatch || ties != games) ? 1 : 0;
+}
+
+
+/*
+ * @release note
+ * | v1.0 2026-10-16 - 3lectron3ats : Initial Release
+ * #
+*/
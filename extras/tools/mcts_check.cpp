@@ -0,0 +1,227 @@
+/**
+  * @file      mcts_check.cpp
+  * @version   v1.0
+  * @author    3lectron3ats <3lectron3ats@gmail.com>
+  * @date      2026.10.16
+  * @brief     Host tool, measure MctsBoard<M,N,K> playouts and play it against Board.
+  * @copyright GPL v3.0
+  * *************************************************************************************
+  * @attention
+  * <h2><center>&copy; COPYRIGHT 2023 3lectron3ats </center></h2>
+  * *************************************************************************************
+  * @note
+  *   Playouts per second are measured from the empty board of each variant.
+  *   On every 3x3 position with friend to move and nobody won, the move of
+  *   MctsBoard<3,3,3> is compared with perfect play; MCTS is not exact, so moves which
+  *   lose the win/tie are only counted.
+  *   Long searches must stay at MCTS_ITERATION_MAX and still take a win at once, both
+  *   with set_Iterations(65535) and with no limit and a long time budget; node score
+  *   is 16 bits and would wrap above it.
+  *   Then MctsBoard and Board(alpha-beta) play each other on 4x4x4 and 5x5x4 with the
+  *   same time budget, taking turns to go first.
+  *   Build and run:
+  *       g++ -O2 -fpermissive -w -DARDUINO=100 -DEE33_HOST_BUILD -Iextras/host -Isrc
+  *           -o mcts_check extras/tools/mcts_check.cpp
+  *       ./mcts_check
+  */
+
+#include <EE33_Tic_Tac_Toe.h>
+#include <EE33_Board.h>
+#include <EE33_Mcts.h>
+
+/** result of perfect play for the one to move, 1 win, 0 tie, -1 lose */
+static int8_t solve(uint16_t own, uint16_t other)
+{
+	static const uint16_t line_mask[8] = {0x07, 0x38, 0x1C0, 0x49, 0x92, 0x124, 0x111, 0x54};
+	int8_t best = -1;
+
+	for (uint8_t line = 0; line < 8; line++)
+	{
+		if ((other & line_mask[line]) == line_mask[line])
+		{
+			return -1;
+		}
+	}
+
+	if ((own | other) == 0x1FF)
+	{
+		return 0;
+	}
+
+	for (uint8_t i = 0; i < 9 && best < 1; i++)
+	{
+		if (!((own | other) & bit(i)))
+		{
+			int8_t result = -solve(other, own | bit(i));
+
+			best = (result > best) ? result : best;
+		}
+	}
+
+	return best;
+}
+
+template <uint8_t M, uint8_t N, uint8_t K>
+static void measure(uint16_t iterations)
+{
+	MctsBoard<M, N, K, 1024> board;
+	unsigned long start = micros(), elapsed;
+
+	board.set_Iterations(iterations);
+	board.BestNextMove(PLAYER_TYPE_FRIEND);
+	elapsed = micros() - start;
+
+	printf("MctsBoard<%u,%u,%u>: %u playouts in %lu us, %lu playouts/s, %u of 1024 nodes(%u bytes)\n",
+		M, N, K, board.get_Playout(), elapsed, (unsigned long)(board.get_Playout() * 1000000ULL / (elapsed ? elapsed : 1)),
+		board.get_NodeUsed(), MctsBoard<M, N, K, 1024>::get_ArenaSize());
+}
+
+static void check_3x3(uint16_t iterations)
+{
+	MctsBoard<3, 3, 3, 512> board;
+	uint32_t checked = 0, weaker = 0;
+
+	board.set_Iterations(iterations);
+
+	for (uint16_t code = 0; code < 19683; code++)
+	{
+		uint16_t own = 0, other = 0, digits = code;
+
+		for (uint8_t i = 0; i < 9; i++, digits /= 3)
+		{
+			own |= (digits % 3 == 1) ? bit(i) : 0;
+			other |= (digits % 3 == 2) ? bit(i) : 0;
+		}
+
+		//friend to move, game not over
+		if (__builtin_popcount(own) > __builtin_popcount(other) || __builtin_popcount(other) > __builtin_popcount(own) + 1 || (own | other) == 0x1FF)
+		{
+			continue;
+		}
+
+		board.clear();
+
+		for (uint8_t i = 0; i < 9; i++)
+		{
+			if (own & bit(i))
+			{
+				board.set_Cell(i, PLAYER_TYPE_FRIEND);
+			}
+			if (other & bit(i))
+			{
+				board.set_Cell(i, PLAYER_TYPE_ENMY);
+			}
+		}
+
+		if (board.Is_Bingo(PLAYER_TYPE_FRIEND) || board.Is_Bingo(PLAYER_TYPE_ENMY))
+		{
+			continue;
+		}
+
+		uint8_t move = board.BestNextMove(PLAYER_TYPE_FRIEND);
+
+		checked++;
+
+		if (-solve(other, own | bit(move)) != solve(own, other))
+		{
+			weaker++;
+		}
+	}
+
+	printf("MctsBoard<3,3,3>: %u positions checked with %u iterations, %u moves weaker than perfect play\n", checked, iterations, weaker);
+}
+
+/** friend has 0 and 1, enmy has 3 and 4, only 2 wins at once */
+static bool check_long(uint16_t iterations, uint32_t budget_us)
+{
+	MctsBoard<3, 3, 3, 512> board;
+	uint8_t move;
+	bool ok;
+
+	board.set_Cell(0, PLAYER_TYPE_FRIEND);
+	board.set_Cell(1, PLAYER_TYPE_FRIEND);
+	board.set_Cell(3, PLAYER_TYPE_ENMY);
+	board.set_Cell(4, PLAYER_TYPE_ENMY);
+
+	board.set_Iterations(iterations);
+	move = board.BestNextMove(PLAYER_TYPE_FRIEND, budget_us);
+
+	ok = (move == 2 && board.get_IterationDone() <= MCTS_ITERATION_MAX);
+
+	printf("MctsBoard<3,3,3>: set_Iterations(%u), %lu us budget: move %u after %u iterations, %s\n",
+		iterations, (unsigned long)budget_us, move, board.get_IterationDone(), (ok) ? "ok" : "FAIL");
+
+	return ok;
+}
+
+template <uint8_t M, uint8_t N, uint8_t K>
+static void match(uint8_t games, uint32_t budget_us)
+{
+	uint8_t win = 0, tie = 0, lose = 0;
+
+	for (uint8_t game = 0; game < games; game++)
+	{
+		MctsBoard<M, N, K, 1024> mcts;
+		Board<M, N, K> alpha_beta;
+		//MCTS is friend, it goes first in even games
+		PLAYER_TYPE player = (game & 1) ? PLAYER_TYPE_ENMY : PLAYER_TYPE_FRIEND;
+
+		mcts.set_Iterations(0);
+
+		while (!mcts.Is_Full())
+		{
+			uint8_t cell = (player == PLAYER_TYPE_FRIEND) ? mcts.BestNextMove(player, budget_us) : alpha_beta.BestNextMove(player, budget_us);
+
+			mcts.set_Cell(cell, player);
+			alpha_beta.set_Cell(cell, player);
+
+			if (mcts.Is_Bingo(player))
+			{
+				break;
+			}
+
+			player = (player == PLAYER_TYPE_FRIEND) ? PLAYER_TYPE_ENMY : PLAYER_TYPE_FRIEND;
+		}
+
+		if (mcts.Is_Bingo(PLAYER_TYPE_FRIEND))
+		{
+			win++;
+		}
+		else if (mcts.Is_Bingo(PLAYER_TYPE_ENMY))
+		{
+			lose++;
+		}
+		else
+		{
+			tie++;
+		}
+	}
+
+	printf("MctsBoard<%u,%u,%u> against Board<%u,%u,%u>, %lu us per move: %u win, %u tie, %u lose\n", M, N, K, M, N, K, (unsigned long)budget_us, win, tie, lose);
+}
+
+int main(void)
+{
+	bool long_ok;
+
+	measure<3, 3, 3>(20000);
+	measure<4, 4, 4>(20000);
+	measure<5, 5, 4>(20000);
+
+	check_3x3(2000);
+
+	long_ok = check_long(65535, 0);
+	long_ok = check_long(0, 10000000) && long_ok;
+
+	match<4, 4, 4>(10, 100000);
+	match<5, 5, 4>(10, 100000);
+
+	return (long_ok) ? 0 : 1;
+}
+
+
+/*
+ * @release note
+ * | v1.0 2026-10-16 - 3lectron3ats : Initial Release
+ * #
+*/
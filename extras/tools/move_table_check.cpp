@@ -0,0 +1,166 @@
+/**
+  * @file      move_table_check.cpp
+  * @version   v1.0
+  * @author    3lectron3ats <3lectron3ats@gmail.com>
+  * @date      2026.10.16
+  * @brief     Host tool, check the flash move table against the minmax search.
+  * @copyright GPL v3.0
+  * *************************************************************************************
+  * @attention
+  * <h2><center>&copy; COPYRIGHT 2023 3lectron3ats </center></h2>
+  * *************************************************************************************
+  * @note
+  *   For every position in the table, the set of moves BestNextMove can choose is
+  *   compared with the set BestNextMove_Lookup can choose. random() of the host stub is
+  *   forced to every tie-break choice to collect the sets.
+  *   Moves of BestNextMove_Retro must get the same win/tie/lose as the moves of the
+  *   search, by the value RetroTable reads after the move.
+  *   Build and run:
+  *       g++ -O2 -fpermissive -w -DARDUINO=100 -DEE33_HOST_BUILD -Iextras/host -Isrc
+  *           -o move_table_check extras/tools/move_table_check.cpp
+  *           src/EE33_LED.cpp src/EE33_Minmax.cpp src/EE33_SimpleQueue.cpp src/EE33_MoveTable.cpp
+  *           src/EE33_Symmetry.cpp src/EE33_MinmaxCache.cpp src/EE33_Matrix.cpp
+  *           src/EE33_RetroTable.cpp
+  *       ./move_table_check
+  */
+
+#include <EE33_Tic_Tac_Toe.h>
+#include <EE33_LED.h>
+#include <EE33_MoveTable.h>
+#include <EE33_RetroTable.h>
+
+byte player_A_pin[LED_SEQ_TOTAL] = {0,4,6,8,10,12,A0,A2,A4};
+byte player_B_pin[LED_SEQ_TOTAL] = {1,5,7,9,11,13,A1,A3,A5};
+
+LED_SQUARE led_square(player_A_pin, player_B_pin);
+
+static uint16_t choice_set(uint8_t backend)
+{
+	uint16_t moves = 0;
+
+	for (long choose = 0; choose < LED_SEQ_TOTAL; choose++)
+	{
+		LED_SEQUENCE next_step;
+
+		host_random_force() = choose;
+		next_step = (backend == 2) ? led_square.BestNextMove_Retro(LED_COLOR_A) : (backend == 1) ? led_square.BestNextMove_Lookup(LED_COLOR_A) : led_square.BestNextMove(LED_COLOR_A);
+
+		moves |= (next_step < LED_SEQ_TOTAL) ? bit(next_step) : 0;
+	}
+
+	host_random_force() = -1;
+
+	return moves;
+}
+
+/** values RetroTable reads after each move, bit 0 enmy wins, bit 1 tie, bit 2 enmy loses */
+static uint8_t retro_result(T_MATRIX_3X3 map_friend, T_MATRIX_3X3 map_enmy, uint16_t moves)
+{
+	uint8_t result = 0, distance;
+
+	for (uint8_t seq = LED_1; seq < LED_SEQ_TOTAL; seq++)
+	{
+		T_MATRIX_3X3 child = map_friend;
+
+		if (moves & bit(seq))
+		{
+			child.d16 |= bit(seq);
+			result |= bit(RetroTable::read(map_enmy, child, &distance) - RETRO_VALUE_WIN);
+		}
+	}
+
+	return result;
+}
+
+static bool has_line(uint16_t map)
+{
+	static const uint16_t line_mask[LINE_SEQ_TOTAL] = {0x07, 0x38, 0x1C0, 0x49, 0x92, 0x124, 0x111, 0x54};
+
+	for (uint8_t i = 0; i < LINE_SEQ_TOTAL; i++)
+	{
+		if ((map & line_mask[i]) == line_mask[i])
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+int main(void)
+{
+	uint32_t checked = 0, legal = 0, mismatch = 0, retro_checked = 0, retro_mismatch = 0;
+
+	led_square.begin();
+
+	for (uint16_t code = 0; code < 19683; code++)
+	{
+		T_MATRIX_3X3 map_friend = {0}, map_enmy = {0};
+		uint16_t digits = code;
+
+		for (uint8_t seq = LED_1; seq < LED_SEQ_TOTAL; seq++, digits /= 3)
+		{
+			map_friend.d16 |= (digits % 3 == 1) ? bit(seq) : 0;
+			map_enmy.d16 |= (digits % 3 == 2) ? bit(seq) : 0;
+		}
+
+		if (MoveTable::index(map_friend, map_enmy) == MOVE_TABLE_INVALID)
+		{
+			continue;
+		}
+
+		led_square.set_allOff();
+
+		for (uint8_t seq = LED_1; seq < LED_SEQ_TOTAL; seq++)
+		{
+			if (map_friend.d16 & bit(seq))
+			{
+				led_square.set_LEDStatus(seq, LED_COLOR_A, LED_STATUS_ON);
+			}
+			if (map_enmy.d16 & bit(seq))
+			{
+				led_square.set_LEDStatus(seq, LED_COLOR_B, LED_STATUS_ON);
+			}
+		}
+
+		uint16_t search_moves = choice_set(0);
+		uint16_t lookup_moves = choice_set(1);
+
+		checked++;
+
+		//legal: game is not over before the last move of enmy
+		legal += (!has_line(map_friend.d16)) ? 1 : 0;
+
+		if (search_moves != lookup_moves)
+		{
+			mismatch++;
+			printf("mismatch friend 0x%03X enmy 0x%03X: search 0x%03X, table 0x%03X\n", map_friend.d16, map_enmy.d16, search_moves, lookup_moves);
+		}
+
+		//only positions of a real game are in the database, and no move after enmy won
+		if (RetroTable::read(map_friend, map_enmy) != RETRO_TABLE_INVALID && !has_line(map_enmy.d16) && search_moves)
+		{
+			uint16_t retro_moves = choice_set(2);
+
+			retro_checked++;
+
+			if (!retro_moves || retro_result(map_friend, map_enmy, retro_moves) != retro_result(map_friend, map_enmy, search_moves))
+			{
+				retro_mismatch++;
+				printf("retro mismatch friend 0x%03X enmy 0x%03X: search 0x%03X, retro 0x%03X\n", map_friend.d16, map_enmy.d16, search_moves, retro_moves);
+			}
+		}
+	}
+
+	printf("%u positions checked(%u reachable with friend to move), %u mismatch\n", checked, legal, mismatch);
+	printf("%u positions checked by retrograde database, %u mismatch\n", retro_checked, retro_mismatch);
+
+	return (mismatch || retro_mismatch) ? 1 : 0;
+}
+
+
+/*
+ * @release note
+ * | v1.0 2026-10-16 - 3lectron3ats : Initial Release
+ * #
+*/
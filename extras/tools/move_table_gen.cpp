@@ -0,0 +1,261 @@
+/**
+  * @file      move_table_gen.cpp
+  * @version   v1.0
+  * @author    3lectron3ats <3lectron3ats@gmail.com>
+  * @date      2026.10.16
+  * @brief     Host tool, generate src/EE33_MoveTable_data.h.
+  * @copyright GPL v3.0
+  * *************************************************************************************
+  * @attention
+  * <h2><center>&copy; COPYRIGHT 2023 3lectron3ats </center></h2>
+  * *************************************************************************************
+  * @note
+  *   Plain minmax(no pruning) with the same score rule as LED_SQUARE::_minmax_cal_score,
+  *   every line of friend adds one line score and every line of enmy takes one off.
+  *   Positions are walked in the order of MoveTable::index(): number of pieces, then
+  *   occupied cells in colex order, then friend cells in colex order. Only canonical
+  *   positions(smallest friend << 9 | enmy of the 8 symmetries, same as
+  *   MatrixSymmetry::canonical) are kept, with their index as the sorted key.
+  *   Build and run:
+  *       g++ -O2 -o move_table_gen extras/tools/move_table_gen.cpp
+  *       ./move_table_gen > src/EE33_MoveTable_data.h
+  */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#define CELL_TOTAL   9
+#define LINE_TOTAL   8
+#define BOARD_MASK   0x1FF
+#define INDEX_TOTAL  6046
+#define SYMMETRY_TOTAL 8
+
+static const uint16_t line_mask[LINE_TOTAL] =
+{
+	0x07, 0x38, 0x1C0, 0x49, 0x92, 0x124, 0x111, 0x54,
+};
+
+/** new position of each cell, same order as MATRIX_SYMMETRY */
+static const int symmetry_cell[SYMMETRY_TOTAL][CELL_TOTAL] =
+{
+	{0, 1, 2, 3, 4, 5, 6, 7, 8},
+	{2, 5, 8, 1, 4, 7, 0, 3, 6},
+	{8, 7, 6, 5, 4, 3, 2, 1, 0},
+	{6, 3, 0, 7, 4, 1, 8, 5, 2},
+	{2, 1, 0, 5, 4, 3, 8, 7, 6},
+	{6, 7, 8, 3, 4, 5, 0, 1, 2},
+	{0, 3, 6, 1, 4, 7, 2, 5, 8},
+	{8, 5, 2, 7, 4, 1, 6, 3, 0},
+};
+
+static int popcount(uint32_t n)
+{
+	int count = 0;
+
+	while (n)
+	{
+		n &= (n - 1);
+		count++;
+	}
+
+	return count;
+}
+
+static int cal_score(uint16_t map_friend, uint16_t map_enmy)
+{
+	int score = 0;
+
+	for (int i = 0; i < LINE_TOTAL; i++)
+	{
+		score += ((map_friend & line_mask[i]) == line_mask[i]) ? 100 : 0;
+		score -= ((map_enmy & line_mask[i]) == line_mask[i]) ? 100 : 0;
+	}
+
+	return score;
+}
+
+static int minmax(uint16_t map_friend, uint16_t map_enmy, bool friend_turn)
+{
+	int score = cal_score(map_friend, map_enmy);
+
+	if (score || (map_friend | map_enmy) == BOARD_MASK)
+	{
+		return score;
+	}
+
+	int best = friend_turn ? -100000 : 100000;
+
+	for (int cell = 0; cell < CELL_TOTAL; cell++)
+	{
+		uint16_t b = 1 << cell;
+
+		if ((map_friend | map_enmy) & b)
+		{
+			continue;
+		}
+
+		score = friend_turn ? minmax(map_friend | b, map_enmy, false) : minmax(map_friend, map_enmy | b, true);
+		best = friend_turn ? (score > best ? score : best) : (score < best ? score : best);
+	}
+
+	return best;
+}
+
+/** mask of every move which gets the best score, same as LED_SQUARE::_BestNextMove_Wrapper */
+static uint16_t best_moves(uint16_t map_friend, uint16_t map_enmy)
+{
+	uint16_t moves = 0;
+	int best = -100000;
+
+	for (int cell = 0; cell < CELL_TOTAL; cell++)
+	{
+		uint16_t b = 1 << cell;
+
+		if ((map_friend | map_enmy) & b)
+		{
+			continue;
+		}
+
+		int score = minmax(map_friend | b, map_enmy, false);
+
+		if (score > best)
+		{
+			best = score;
+			moves = b;
+		}
+		else if (score == best)
+		{
+			moves |= b;
+		}
+	}
+
+	return moves;
+}
+
+/** scatter low bits of value into the set bits of mask */
+static uint16_t deposit(uint16_t value, uint16_t mask)
+{
+	uint16_t result = 0;
+
+	for (int cell = 0; cell < CELL_TOTAL; cell++)
+	{
+		if (mask & (1 << cell))
+		{
+			result |= (value & 1) ? (1 << cell) : 0;
+			value >>= 1;
+		}
+	}
+
+	return result;
+}
+
+static uint16_t transform(uint16_t map, int symmetry)
+{
+	uint16_t result = 0;
+
+	for (int cell = 0; cell < CELL_TOTAL; cell++)
+	{
+		result |= (map & (1 << cell)) ? (1 << symmetry_cell[symmetry][cell]) : 0;
+	}
+
+	return result;
+}
+
+static bool is_canonical(uint16_t map_friend, uint16_t map_enmy)
+{
+	uint32_t key = ((uint32_t)map_friend << CELL_TOTAL) | map_enmy;
+
+	for (int symmetry = 1; symmetry < SYMMETRY_TOTAL; symmetry++)
+	{
+		if ((((uint32_t)transform(map_friend, symmetry) << CELL_TOTAL) | transform(map_enmy, symmetry)) < key)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+int main(void)
+{
+	static uint16_t table_key[INDEX_TOTAL];
+	static uint16_t table[INDEX_TOTAL];
+	int index = 0, size = 0;
+
+	for (int occupy_number = 0; occupy_number <= CELL_TOTAL; occupy_number++)
+	{
+		int friend_number = occupy_number / 2;
+
+		for (uint16_t occupy = 0; occupy <= BOARD_MASK; occupy++)
+		{
+			if (popcount(occupy) != occupy_number)
+			{
+				continue;
+			}
+
+			for (uint16_t sub = 0; sub < (1 << occupy_number); sub++)
+			{
+				if (popcount(sub) != friend_number)
+				{
+					continue;
+				}
+
+				uint16_t map_friend = deposit(sub, occupy);
+				uint16_t map_enmy = occupy & ~map_friend;
+
+				if (is_canonical(map_friend, map_enmy))
+				{
+					table_key[size] = index;
+					table[size++] = best_moves(map_friend, map_enmy);
+				}
+
+				index++;
+			}
+		}
+	}
+
+	if (index != INDEX_TOTAL)
+	{
+		fprintf(stderr, "%d positions, expect %d\n", index, INDEX_TOTAL);
+		return 1;
+	}
+
+	printf("/**\n");
+	printf("  * @file      EE33_MoveTable_data.h\n");
+	printf("  * @brief     Generated by extras/tools/move_table_gen.cpp, do not edit.\n");
+	printf("  * @copyright GPL v3.0\n");
+	printf("  */\n\n");
+	printf("#ifndef EE33_MOVE_TABLE_DATA_H\n");
+	printf("#define EE33_MOVE_TABLE_DATA_H\n\n");
+	printf("#if MOVE_TABLE_SIZE != %d\n", size);
+	printf("#error \"MOVE_TABLE_SIZE does not match the generated table\"\n");
+	printf("#endif\n\n");
+	printf("/** MoveTable::index() of canonical positions, ascending */\n");
+	printf("const uint16_t move_table_key[MOVE_TABLE_SIZE] PROGMEM =\n{\n");
+
+	for (int i = 0; i < size; i++)
+	{
+		printf("%s%4d,%s", (i % 12) ? " " : "\t", table_key[i], (i % 12 == 11 || i == size - 1) ? "\n" : "");
+	}
+
+	printf("};\n\n");
+	printf("/** mask of best moves of canonical positions */\n");
+	printf("const uint16_t move_table[MOVE_TABLE_SIZE] PROGMEM =\n{\n");
+
+	for (int i = 0; i < size; i++)
+	{
+		printf("%s0x%03X,%s", (i % 12) ? " " : "\t", table[i], (i % 12 == 11 || i == size - 1) ? "\n" : "");
+	}
+
+	printf("};\n\n");
+	printf("#endif  //EE33_MOVE_TABLE_DATA_H\n");
+
+	return 0;
+}
+
+
+/*
+ * @release note
+ * | v1.0 2026-10-16 - 3lectron3ats : Initial Release
+ * #
+*/
@@ -0,0 +1,276 @@
+/**
+  * @file      ponder_check.cpp
+  * @version   v1.0
+  * @author    3lectron3ats <3lectron3ats@gmail.com>
+  * @date      2026.10.16
+  * @brief     Host tool, check the pondered replies of MinmaxEngine against BestNextMove.
+  * @copyright GPL v3.0
+  * *************************************************************************************
+  * @attention
+  * <h2><center>&copy; COPYRIGHT 2023 3lectron3ats </center></h2>
+  * *************************************************************************************
+  * @note
+  *   Every position of a real game with friend just moved is pondered, and the reply to
+  *   each move of enmy must be the set of moves BestNextMove can choose after it, taken
+  *   from another engine with random() of the host stub forced to every tie-break.
+  *     whole    one ponderRoutine without time limit
+  *     sliced   ponderRoutine of 1 us until all replies are ready, so the search is
+  *              cut in the middle and resumed from minmax_stack again and again
+  *     hint     one slice, ScoreAllMoves for enmy like a hint display, which takes
+  *              minmax_stack in the middle of a pondered search, then the rest of
+  *              pondering; BestNextMove after enmy moves must still be right
+  *     instant  after enmy moves, BestNextMove must take the reply without a node
+  *   Build and run:
+  *       g++ -O2 -fpermissive -w -DARDUINO=100 -DEE33_HOST_BUILD -Iextras/host -Isrc
+  *           -o ponder_check extras/tools/ponder_check.cpp
+  *           src/EE33_Minmax.cpp src/EE33_MinmaxCache.cpp src/EE33_Matrix.cpp src/EE33_Symmetry.cpp
+  *       ./ponder_check
+  */
+
+#include <EE33_Tic_Tac_Toe.h>
+#include <EE33_Minmax.h>
+
+/** time of one slice in sliced case, in microseconds */
+#define PONDER_CHECK_SLICE_US     1
+
+/** give up slicing after this number of slices, the rest is done without time limit */
+#define PONDER_CHECK_SLICE_LIMIT  100000
+
+/** engine which ponders */
+MinmaxEngine ponder_engine;
+
+/** engine which searches the same positions from scratch */
+MinmaxEngine search_engine;
+
+static bool has_line(uint16_t map)
+{
+	T_MATRIX_3X3 matrix;
+
+	matrix.d16 = map;
+
+	return MatrixLine::Is_Bingo(matrix);
+}
+
+/** moves BestNextMove can choose, 0 if game is over */
+static uint16_t choice_set(uint16_t own, uint16_t other)
+{
+	T_MATRIX_3X3 map_friend, map_enmy;
+	uint16_t moves = 0;
+
+	if (has_line(other) || (own | other) == MATRIX_3X3_MASK)
+	{
+		return 0;
+	}
+
+	map_friend.d16 = own;
+	map_enmy.d16 = other;
+
+	for (long choose = 0; choose < MATRIX_3X3_ELEMENT_TOTAL; choose++)
+	{
+		MATRIX_3X3_ELEMENT next_step;
+
+		host_random_force() = choose;
+		next_step = search_engine.BestNextMove(map_friend, map_enmy, MatrixHash::hash(map_friend, map_enmy, PLAYER_TYPE_FRIEND), 0);
+
+		moves |= (next_step < MATRIX_3X3_ELEMENT_TOTAL) ? MatrixBit::mask(next_step) : 0;
+	}
+
+	host_random_force() = -1;
+
+	return moves;
+}
+
+static bool all_ready(uint16_t empty)
+{
+	uint16_t moves;
+
+	while (empty)
+	{
+		if (!ponder_engine.get_PonderReply(MatrixBit::pop(&empty), &moves))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/** compare every pondered reply with expect, return number of mismatch */
+static uint32_t compare(const char *name, uint16_t own, uint16_t other, const uint16_t expect[MATRIX_3X3_ELEMENT_TOTAL])
+{
+	uint16_t empty = ~(own | other) & MATRIX_3X3_MASK, moves;
+	uint32_t mismatch = 0;
+
+	while (empty)
+	{
+		MATRIX_3X3_ELEMENT enmy_move = MatrixBit::pop(&empty);
+
+		if (!ponder_engine.get_PonderReply(enmy_move, &moves))
+		{
+			moves = MATRIX_3X3_MASK + 1;  //not ready, never a valid set
+		}
+
+		if (moves != expect[enmy_move])
+		{
+			mismatch++;
+			printf("%s mismatch friend 0x%03X enmy 0x%03X move %u: ponder 0x%03X, search 0x%03X\n", name, own, other, enmy_move, moves, expect[enmy_move]);
+		}
+	}
+
+	return mismatch;
+}
+
+int main(void)
+{
+	uint32_t bases = 0, replies = 0, slices = 0, slice_out = 0, instant = 0;
+	uint32_t hint_checked = 0, hint_stopped = 0, whole_mismatch = 0, sliced_mismatch = 0, hint_mismatch = 0, instant_mismatch = 0;
+
+	randomSeed(1);
+
+	for (uint16_t code = 0; code < 19683; code++)
+	{
+		T_MATRIX_3X3 map_friend = {0}, map_enmy = {0};
+		uint16_t expect[MATRIX_3X3_ELEMENT_TOTAL], digits = code, empty, hash;
+		int8_t diff;
+
+		for (uint8_t i = 0; i < MATRIX_3X3_ELEMENT_TOTAL; i++, digits /= 3)
+		{
+			map_friend.d16 |= (digits % 3 == 1) ? MatrixBit::mask(i) : 0;
+			map_enmy.d16 |= (digits % 3 == 2) ? MatrixBit::mask(i) : 0;
+		}
+
+		//friend just moved, nobody won and enmy has a move
+		diff = (int8_t)MatrixBit::count(map_friend.d16) - (int8_t)MatrixBit::count(map_enmy.d16);
+
+		if ((diff != 0 && diff != 1) || has_line(map_friend.d16) || has_line(map_enmy.d16) || MatrixBit::Is_Full(map_friend, map_enmy))
+		{
+			continue;
+		}
+
+		bases++;
+		empty = MatrixBit::empty(map_friend, map_enmy);
+		hash = MatrixHash::hash(map_friend, map_enmy, PLAYER_TYPE_FRIEND);
+
+		for (uint16_t todo = empty; todo; )
+		{
+			MATRIX_3X3_ELEMENT enmy_move = MatrixBit::pop(&todo);
+
+			expect[enmy_move] = choice_set(map_friend.d16, map_enmy.d16 | MatrixBit::mask(enmy_move));
+			replies++;
+		}
+
+		//whole
+		ponder_engine.flush();
+		ponder_engine.ponderStart(map_friend, map_enmy, hash);
+		ponder_engine.ponderRoutine(map_friend, map_enmy, 0);
+		whole_mismatch += compare("whole", map_friend.d16, map_enmy.d16, expect);
+
+		//sliced
+		ponder_engine.flush();
+		ponder_engine.ponderStart(map_friend, map_enmy, hash);
+
+		for (uint32_t n = 0; !all_ready(empty); n++, slices++)
+		{
+			if (n == PONDER_CHECK_SLICE_LIMIT)
+			{
+				ponder_engine.ponderRoutine(map_friend, map_enmy, 0);
+				slice_out++;
+				break;
+			}
+
+			ponder_engine.ponderRoutine(map_friend, map_enmy, PONDER_CHECK_SLICE_US);
+		}
+
+		sliced_mismatch += compare("sliced", map_friend.d16, map_enmy.d16, expect);
+
+		//hint
+		for (uint16_t todo = empty; todo; )
+		{
+			MATRIX_3X3_ELEMENT enmy_move = MatrixBit::pop(&todo);
+			T_MATRIX_3X3 map_moved = map_enmy;
+			uint16_t moves = 0, reply;
+
+			if (!expect[enmy_move])
+			{
+				continue;  //game over after the move
+			}
+
+			map_moved.d16 |= MatrixBit::mask(enmy_move);
+
+			for (long choose = 0; choose < MATRIX_3X3_ELEMENT_TOTAL; choose++)
+			{
+				int8_t scores[MATRIX_3X3_ELEMENT_TOTAL];
+				MATRIX_3X3_ELEMENT next_step;
+
+				ponder_engine.ponderStart(map_friend, map_enmy, hash);
+				ponder_engine.ponderRoutine(map_friend, map_enmy, PONDER_CHECK_SLICE_US);
+				ponder_engine.ScoreAllMoves(map_enmy, map_friend, MatrixHash::hash(map_enmy, map_friend, PLAYER_TYPE_FRIEND), scores);
+				ponder_engine.ponderRoutine(map_friend, map_enmy, 0);
+
+				hint_stopped += (ponder_engine.get_PonderReply(enmy_move, &reply)) ? 0 : 1;
+
+				host_random_force() = choose;
+				next_step = ponder_engine.BestNextMove(map_friend, map_moved, hash ^ MatrixHash::key(PLAYER_TYPE_ENMY, enmy_move), 0);
+				host_random_force() = -1;
+
+				moves |= (next_step < MATRIX_3X3_ELEMENT_TOTAL) ? MatrixBit::mask(next_step) : 0;
+			}
+
+			hint_checked++;
+
+			if (moves != expect[enmy_move])
+			{
+				hint_mismatch++;
+				printf("hint mismatch friend 0x%03X enmy 0x%03X move %u: 0x%03X, search 0x%03X\n", map_friend.d16, map_enmy.d16, enmy_move, moves, expect[enmy_move]);
+			}
+		}
+
+		//instant
+		for (uint16_t todo = empty; todo; )
+		{
+			MATRIX_3X3_ELEMENT enmy_move = MatrixBit::pop(&todo);
+			T_MATRIX_3X3 map_moved = map_enmy;
+			T_MINMAX_SEARCH_STATS before, after;
+			MATRIX_3X3_ELEMENT next_step;
+
+			if (!expect[enmy_move])
+			{
+				continue;  //game over after the move
+			}
+
+			ponder_engine.ponderStart(map_friend, map_enmy, hash);
+			ponder_engine.ponderRoutine(map_friend, map_enmy, 0);
+
+			map_moved.d16 |= MatrixBit::mask(enmy_move);
+
+			ponder_engine.get_SearchStats(&before);
+			next_step = ponder_engine.BestNextMove(map_friend, map_moved, hash ^ MatrixHash::key(PLAYER_TYPE_ENMY, enmy_move), 0);
+			ponder_engine.get_SearchStats(&after);
+
+			if (after.node == before.node && next_step < MATRIX_3X3_ELEMENT_TOTAL && (expect[enmy_move] & MatrixBit::mask(next_step)))
+			{
+				instant++;
+			}
+			else
+			{
+				instant_mismatch++;
+				printf("instant mismatch friend 0x%03X enmy 0x%03X move %u: %u nodes, next %u\n", map_friend.d16, map_enmy.d16, enmy_move, after.node - before.node, next_step);
+			}
+		}
+	}
+
+	printf("%u base positions, %u replies each case\n", bases, replies);
+	printf("whole   %u mismatch\n", whole_mismatch);
+	printf("sliced  %u mismatch, %u slices of %u us, %u positions over %u slices\n", sliced_mismatch, slices, PONDER_CHECK_SLICE_US, slice_out, PONDER_CHECK_SLICE_LIMIT);
+	printf("hint    %u mismatch, %u of %u pondering stopped by ScoreAllMoves\n", hint_mismatch, hint_stopped, hint_checked * MATRIX_3X3_ELEMENT_TOTAL);
+	printf("instant %u taken without search, %u mismatch\n", instant, instant_mismatch);
+
+	return (whole_mismatch || sliced_mismatch || hint_mismatch || instant_mismatch) ? 1 : 0;
+}
+
+
+/*
+ * @release note
+ * | v1.0 2026-10-16 - 3lectron3ats : Initial Release
+ * #
+*/
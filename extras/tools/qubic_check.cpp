@@ -0,0 +1,330 @@
+/**
+  * @file      qubic_check.cpp
+  * @version   v1.0
+  * @author    3lectron3ats <3lectron3ats@gmail.com>
+  * @date      2026.10.16
+  * @brief     Host tool, check QubicBoard and let its engine play.
+  * @copyright GPL v3.0
+  * *************************************************************************************
+  * @attention
+  * <h2><center>&copy; COPYRIGHT 2023 3lectron3ats </center></h2>
+  * *************************************************************************************
+  * @note
+  *   Line tables are checked against lines found by walking the cube. Random games
+  *   check score, threats and bingo kept piece by piece against a scan of all lines,
+  *   and that a search leaves the cube as it was. Near the end of game the search
+  *   reaches every end, so its move must keep the value of plain negamax.
+  *   Then the engine plays against random moves and against itself with a time budget.
+  *   Build and run:
+  *       g++ -O2 -fpermissive -w -DARDUINO=100 -DEE33_HOST_BUILD -Iextras/host -Isrc
+  *           -o qubic_check extras/tools/qubic_check.cpp src/EE33_Qubic.cpp
+  *       ./qubic_check
+  */
+
+#include <EE33_Tic_Tac_Toe.h>
+#include <EE33_Qubic.h>
+
+static uint64_t walked_line[QUBIC_LINE_TOTAL];
+
+/** all lines of 4 cells in any of the 13 directions */
+static uint8_t walk_lines(void)
+{
+	uint8_t total = 0;
+
+	for (int8_t dz = 0; dz <= 1; dz++)
+	for (int8_t dy = -1; dy <= 1; dy++)
+	for (int8_t dx = -1; dx <= 1; dx++)
+	{
+		//one of each pair of opposite directions
+		if (dz * 9 + dy * 3 + dx <= 0)
+		{
+			continue;
+		}
+
+		for (int8_t z = 0; z < QUBIC_LENGTH; z++)
+		for (int8_t y = 0; y < QUBIC_LENGTH; y++)
+		for (int8_t x = 0; x < QUBIC_LENGTH; x++)
+		{
+			int8_t ex = x + 3 * dx, ey = y + 3 * dy, ez = z + 3 * dz;
+			uint64_t mask = 0;
+
+			if (ex < 0 || ex >= QUBIC_LENGTH || ey < 0 || ey >= QUBIC_LENGTH || ez >= QUBIC_LENGTH)
+			{
+				continue;
+			}
+
+			for (int8_t i = 0; i < QUBIC_LENGTH; i++)
+			{
+				mask |= QUBIC_BIT(QubicBoard::cell(x + i * dx, y + i * dy, z + i * dz));
+			}
+
+			walked_line[total++] = mask;
+		}
+	}
+
+	return total;
+}
+
+static uint32_t check_tables(void)
+{
+	uint32_t mismatch = 0;
+	uint8_t total = walk_lines(), super = 0;
+
+	if (total != QUBIC_LINE_TOTAL)
+	{
+		mismatch++;
+	}
+
+	for (uint8_t i = 0; i < total; i++)
+	{
+		uint8_t found = 0;
+
+		for (uint8_t line = 0; line < QUBIC_LINE_TOTAL; line++)
+		{
+			found += QubicBoard::get_Line(line) == walked_line[i];
+		}
+
+		mismatch += found != 1;
+	}
+
+	for (uint8_t cell = 0; cell < QUBIC_CELL_TOTAL; cell++)
+	{
+		uint8_t through = 0;
+
+		for (uint8_t line = 0; line < QUBIC_LINE_TOTAL; line++)
+		{
+			through += (QubicBoard::get_Line(line) & QUBIC_BIT(cell)) != 0;
+		}
+
+		super += through == QUBIC_CELL_LINE_MAX;
+		mismatch += through != QUBIC_CELL_LINE_MAX && through != QUBIC_LENGTH;
+	}
+
+	printf("QubicBoard: %u lines walked, %u cells on %u lines, %u mismatch\n", total, super, QUBIC_CELL_LINE_MAX, mismatch);
+
+	return mismatch;
+}
+
+/** cube state from a scan of all lines matches what QubicBoard keeps */
+static bool check_state(QubicBoard &cube)
+{
+	static const int16_t value[QUBIC_LENGTH + 1] = {0, 1, 4, 32, 0};
+	uint64_t own = cube.get_Map(PLAYER_TYPE_FRIEND), other = cube.get_Map(PLAYER_TYPE_ENMY);
+	uint64_t threat[2] = {0, 0};
+	bool bingo[2] = {false, false};
+	int16_t score = 0;
+
+	for (uint8_t line = 0; line < QUBIC_LINE_TOTAL; line++)
+	{
+		uint64_t mask = QubicBoard::get_Line(line);
+		uint8_t count_friend = __builtin_popcountll(own & mask), count_enmy = __builtin_popcountll(other & mask);
+
+		if (!count_enmy)
+		{
+			score += value[count_friend];
+			threat[PLAYER_TYPE_FRIEND] |= (count_friend == 3) ? mask & ~own : 0;
+			bingo[PLAYER_TYPE_FRIEND] |= count_friend == 4;
+		}
+
+		if (!count_friend)
+		{
+			score -= value[count_enmy];
+			threat[PLAYER_TYPE_ENMY] |= (count_enmy == 3) ? mask & ~other : 0;
+			bingo[PLAYER_TYPE_ENMY] |= count_enmy == 4;
+		}
+	}
+
+	return score == cube.get_Score()
+		&& threat[PLAYER_TYPE_FRIEND] == cube.get_Threat(PLAYER_TYPE_FRIEND) && threat[PLAYER_TYPE_ENMY] == cube.get_Threat(PLAYER_TYPE_ENMY)
+		&& bingo[PLAYER_TYPE_FRIEND] == cube.Is_Bingo(PLAYER_TYPE_FRIEND) && bingo[PLAYER_TYPE_ENMY] == cube.Is_Bingo(PLAYER_TYPE_ENMY);
+}
+
+static uint8_t random_move(QubicBoard &cube)
+{
+	uint64_t empty = ~(cube.get_Map(PLAYER_TYPE_FRIEND) | cube.get_Map(PLAYER_TYPE_ENMY));
+	uint8_t cell = random(QUBIC_CELL_TOTAL);
+
+	while (!(empty & QUBIC_BIT(cell)))
+	{
+		cell = (cell + 1) % QUBIC_CELL_TOTAL;
+	}
+
+	return cell;
+}
+
+static bool has_line(uint64_t map)
+{
+	for (uint8_t line = 0; line < QUBIC_LINE_TOTAL; line++)
+	{
+		if ((map & QubicBoard::get_Line(line)) == QubicBoard::get_Line(line))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/** result of perfect play for the one to move, 1 win, 0 tie, -1 lose */
+static int8_t negamax(uint64_t own, uint64_t other)
+{
+	int8_t best = -1;
+
+	if (has_line(other))
+	{
+		return -1;
+	}
+
+	if ((own | other) == ~(uint64_t)0)
+	{
+		return 0;
+	}
+
+	for (uint8_t cell = 0; cell < QUBIC_CELL_TOTAL && best < 1; cell++)
+	{
+		if (!((own | other) & QUBIC_BIT(cell)))
+		{
+			int8_t result = -negamax(other, own | QUBIC_BIT(cell));
+
+			best = (result > best) ? result : best;
+		}
+	}
+
+	return best;
+}
+
+static uint32_t check_random(uint16_t games)
+{
+	uint32_t moves = 0, mismatch = 0;
+
+	for (uint16_t game = 0; game < games; game++)
+	{
+		QubicBoard cube;
+		PLAYER_TYPE player = PLAYER_TYPE_FRIEND;
+
+		while (!cube.Is_Full() && !cube.Is_Bingo(PLAYER_TYPE_FRIEND) && !cube.Is_Bingo(PLAYER_TYPE_ENMY))
+		{
+			cube.set_Cell(random_move(cube), player);
+			moves++;
+
+			mismatch += !check_state(cube);
+
+			//a search every few moves, it must take back what it tried
+			if (!(moves % 8) && !cube.Is_Full())
+			{
+				uint64_t own = cube.get_Map(PLAYER_TYPE_FRIEND), other = cube.get_Map(PLAYER_TYPE_ENMY);
+
+				cube.BestNextMove(player, 2000);
+
+				mismatch += own != cube.get_Map(PLAYER_TYPE_FRIEND) || other != cube.get_Map(PLAYER_TYPE_ENMY) || !check_state(cube);
+			}
+
+			player = (player == PLAYER_TYPE_FRIEND) ? PLAYER_TYPE_ENMY : PLAYER_TYPE_FRIEND;
+		}
+	}
+
+	printf("QubicBoard: %u random games, %u moves checked, %u mismatch\n", games, moves, mismatch);
+
+	return mismatch;
+}
+
+static uint32_t check_endgame(uint16_t positions, uint8_t empty)
+{
+	uint32_t checked = 0, mismatch = 0;
+
+	while (checked < positions)
+	{
+		QubicBoard cube;
+		PLAYER_TYPE player = PLAYER_TYPE_FRIEND;
+
+		for (uint8_t i = 0; i < QUBIC_CELL_TOTAL - empty; i++)
+		{
+			cube.set_Cell(random_move(cube), player);
+			player = (player == PLAYER_TYPE_FRIEND) ? PLAYER_TYPE_ENMY : PLAYER_TYPE_FRIEND;
+		}
+
+		if (cube.Is_Bingo(PLAYER_TYPE_FRIEND) || cube.Is_Bingo(PLAYER_TYPE_ENMY))
+		{
+			continue;
+		}
+
+		PLAYER_TYPE other = (player == PLAYER_TYPE_FRIEND) ? PLAYER_TYPE_ENMY : PLAYER_TYPE_FRIEND;
+		uint64_t own_map = cube.get_Map(player), other_map = cube.get_Map(other);
+		uint8_t move = cube.BestNextMove(player);
+
+		checked++;
+
+		if (-negamax(other_map, own_map | QUBIC_BIT(move)) != negamax(own_map, other_map))
+		{
+			mismatch++;
+		}
+	}
+
+	printf("QubicBoard: %u positions with %u empty cells, %u mismatch with negamax\n", checked, empty, mismatch);
+
+	return mismatch;
+}
+
+static void play_random(uint8_t games, uint32_t budget_us)
+{
+	uint8_t win = 0, tie = 0, lose = 0;
+
+	for (uint8_t game = 0; game < games; game++)
+	{
+		QubicBoard cube;
+		//engine is friend, it goes first in even games
+		PLAYER_TYPE player = (game & 1) ? PLAYER_TYPE_ENMY : PLAYER_TYPE_FRIEND;
+
+		while (!cube.Is_Full() && !cube.Is_Bingo(PLAYER_TYPE_FRIEND) && !cube.Is_Bingo(PLAYER_TYPE_ENMY))
+		{
+			cube.set_Cell((player == PLAYER_TYPE_FRIEND) ? cube.BestNextMove(player, budget_us) : random_move(cube), player);
+			player = (player == PLAYER_TYPE_FRIEND) ? PLAYER_TYPE_ENMY : PLAYER_TYPE_FRIEND;
+		}
+
+		win += cube.Is_Bingo(PLAYER_TYPE_FRIEND);
+		lose += cube.Is_Bingo(PLAYER_TYPE_ENMY);
+		tie += !cube.Is_Bingo(PLAYER_TYPE_FRIEND) && !cube.Is_Bingo(PLAYER_TYPE_ENMY);
+	}
+
+	printf("QubicBoard against random moves, %lu us per move: %u win, %u tie, %u lose\n", (unsigned long)budget_us, win, tie, lose);
+}
+
+static void self_play(uint32_t budget_us)
+{
+	QubicBoard cube;
+	PLAYER_TYPE player = PLAYER_TYPE_FRIEND;
+	uint8_t moves = 0;
+	uint32_t start = micros();
+
+	printf("QubicBoard: %u bytes object, %u bytes stack, %lu us per move\n", (unsigned)sizeof(QubicBoard), QubicBoard::get_SearchStackSize(), (unsigned long)budget_us);
+
+	while (!cube.Is_Full() && !cube.Is_Bingo(PLAYER_TYPE_FRIEND) && !cube.Is_Bingo(PLAYER_TYPE_ENMY))
+	{
+		cube.set_Cell(cube.BestNextMove(player, budget_us), player);
+		player = (player == PLAYER_TYPE_FRIEND) ? PLAYER_TYPE_ENMY : PLAYER_TYPE_FRIEND;
+		moves++;
+	}
+
+	printf("  %s after %u moves, %u nodes in %lu us\n", cube.Is_Bingo(PLAYER_TYPE_FRIEND) ? "X wins" : cube.Is_Bingo(PLAYER_TYPE_ENMY) ? "O wins" : "tie",
+		moves, cube.get_SearchNode(), (unsigned long)(micros() - start));
+}
+
+int main(void)
+{
+	uint32_t mismatch = check_tables();
+
+	mismatch += check_random(100);
+	mismatch += check_endgame(500, 7);
+
+	play_random(10, 20000);
+	self_play(100000);
+
+	return mismatch ? 1 : 0;
+}
+
+
+/*
+ * @release note
+ * | v1.0 2026-10-16 - 3lectron3ats : Initial Release
+ * #
+*/
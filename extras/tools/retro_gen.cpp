@@ -0,0 +1,365 @@
+/**
+  * @file      retro_gen.cpp
+  * @version   v1.0
+  * @author    3lectron3ats <3lectron3ats@gmail.com>
+  * @date      2026.10.16
+  * @brief     Host tool, generate the retrograde database of Tic-Tac-Toe.
+  * @copyright GPL v3.0
+  * *************************************************************************************
+  * @attention
+  * <h2><center>&copy; COPYRIGHT 2023 3lectron3ats </center></h2>
+  * *************************************************************************************
+  * @note
+  *   Reachable positions are found forward from the empty matrix, then values are
+  *   walked backward from the end of game: a position with a lost child wins, a
+  *   position whose children all win loses. Positions are taken out of the queue in
+  *   order of distance, so the winner gets the shortest way and the loser the longest.
+  *   What is never solved is a tie, it lasts until the matrix is full.
+  *   Every position is checked against plain minmax before output.
+  *   Index and nibble code are the same as RetroTable(src/EE33_RetroTable.h):
+  *   digit n of the ternary index is cell n, 0 empty, 1 the one to move, 2 the other.
+  *   Binary file is a 16 bytes header(magic, slot total, data offset) and the same
+  *   packed nibbles as the flash table, so it can be mapped into memory as it is.
+  *   Build and run:
+  *       g++ -O2 -o retro_gen extras/tools/retro_gen.cpp
+  *       ./retro_gen src/EE33_RetroTable_data.h retro_3x3.bin
+  */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#define CELL_TOTAL   9
+#define LINE_TOTAL   8
+#define BOARD_MASK   0x1FF
+#define SLOT_TOTAL   19683
+#define TABLE_SIZE   ((SLOT_TOTAL + 1) / 2)
+
+#define VALUE_NONE   0
+#define VALUE_WIN    1
+#define VALUE_DRAW   2
+#define VALUE_LOSE   3
+
+static const uint16_t line_mask[LINE_TOTAL] =
+{
+	0x07, 0x38, 0x1C0, 0x49, 0x92, 0x124, 0x111, 0x54,
+};
+
+typedef struct
+{
+	char magic[8];                 /*!< "EE33RTB" */
+	uint32_t slot_total;           /*!< 3^9 */
+	uint32_t offset;               /*!< first byte of packed nibbles */
+} T_RETRO_FILE_HEADER;
+
+static uint8_t value[SLOT_TOTAL];
+static uint8_t distance[SLOT_TOTAL];
+static uint8_t pending[SLOT_TOTAL];
+static bool reachable[SLOT_TOTAL];
+static uint16_t queue[SLOT_TOTAL];
+
+static bool has_line(uint16_t map)
+{
+	for (int i = 0; i < LINE_TOTAL; i++)
+	{
+		if ((map & line_mask[i]) == line_mask[i])
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static uint16_t encode(uint16_t own, uint16_t other)
+{
+	uint16_t index = 0;
+
+	for (int cell = CELL_TOTAL - 1; cell >= 0; cell--)
+	{
+		index = index * 3 + ((own >> cell) & 1) + 2 * ((other >> cell) & 1);
+	}
+
+	return index;
+}
+
+static void decode(uint16_t index, uint16_t *own, uint16_t *other)
+{
+	*own = 0;
+	*other = 0;
+
+	for (int cell = 0; cell < CELL_TOTAL; cell++, index /= 3)
+	{
+		*own |= (index % 3 == 1) ? (1 << cell) : 0;
+		*other |= (index % 3 == 2) ? (1 << cell) : 0;
+	}
+}
+
+static bool is_terminal(uint16_t own, uint16_t other)
+{
+	return has_line(other) || (own | other) == BOARD_MASK;
+}
+
+static void walk_forward(uint16_t own, uint16_t other)
+{
+	uint16_t index = encode(own, other);
+
+	if (reachable[index])
+	{
+		return;
+	}
+
+	reachable[index] = true;
+
+	if (is_terminal(own, other))
+	{
+		return;
+	}
+
+	for (int cell = 0; cell < CELL_TOTAL; cell++)
+	{
+		if (!((own | other) & (1 << cell)))
+		{
+			walk_forward(other, own | (1 << cell));
+		}
+	}
+}
+
+static void walk_backward(void)
+{
+	int head = 0, tail = 0;
+
+	for (uint16_t index = 0; index < SLOT_TOTAL; index++)
+	{
+		uint16_t own, other;
+
+		if (!reachable[index])
+		{
+			continue;
+		}
+
+		decode(index, &own, &other);
+
+		if (has_line(other))
+		{
+			value[index] = VALUE_LOSE;
+			queue[tail++] = index;
+		}
+		else if ((own | other) != BOARD_MASK)
+		{
+			pending[index] = CELL_TOTAL - __builtin_popcount(own | other);
+		}
+	}
+
+	while (head < tail)
+	{
+		uint16_t index = queue[head++], own, other;
+
+		decode(index, &own, &other);
+
+		//the one who moved last takes a piece back
+		for (int cell = 0; cell < CELL_TOTAL; cell++)
+		{
+			if (!(other & (1 << cell)))
+			{
+				continue;
+			}
+
+			uint16_t parent = encode(other & ~(1 << cell), own);
+
+			if (!reachable[parent] || is_terminal(other & ~(1 << cell), own) || value[parent] != VALUE_NONE)
+			{
+				continue;
+			}
+
+			if (value[index] == VALUE_LOSE)
+			{
+				value[parent] = VALUE_WIN;
+				distance[parent] = distance[index] + 1;
+				queue[tail++] = parent;
+			}
+			else if (--pending[parent] == 0)
+			{
+				value[parent] = VALUE_LOSE;
+				distance[parent] = distance[index] + 1;
+				queue[tail++] = parent;
+			}
+		}
+	}
+
+	for (uint16_t index = 0; index < SLOT_TOTAL; index++)
+	{
+		uint16_t own, other;
+
+		if (reachable[index] && value[index] == VALUE_NONE)
+		{
+			decode(index, &own, &other);
+			value[index] = VALUE_DRAW;
+			distance[index] = CELL_TOTAL - __builtin_popcount(own | other);
+		}
+	}
+}
+
+/** value and distance by plain minmax, winner takes the shortest way */
+static int minmax(uint16_t own, uint16_t other, int *plies)
+{
+	int best = -2, best_plies = 0;
+
+	if (has_line(other))
+	{
+		*plies = 0;
+		return -1;
+	}
+
+	if ((own | other) == BOARD_MASK)
+	{
+		*plies = 0;
+		return 0;
+	}
+
+	for (int cell = 0; cell < CELL_TOTAL; cell++)
+	{
+		int result, result_plies;
+
+		if ((own | other) & (1 << cell))
+		{
+			continue;
+		}
+
+		result = -minmax(other, own | (1 << cell), &result_plies);
+		result_plies++;
+
+		if (result > best || (result == best && ((result > 0) ? (result_plies < best_plies) : (result_plies > best_plies))))
+		{
+			best = result;
+			best_plies = result_plies;
+		}
+	}
+
+	*plies = best_plies;
+
+	return best;
+}
+
+/** 0 illegal, 1 tie, 2 ~ 6 lose in 0, 2 ... 8 plies, 7 ~ 11 win in 1, 3 ... 9 plies */
+static uint8_t nibble(uint16_t index)
+{
+	switch (value[index])
+	{
+	case VALUE_DRAW:
+		return 1;
+	case VALUE_LOSE:
+		return 2 + distance[index] / 2;
+	case VALUE_WIN:
+		return 7 + distance[index] / 2;
+	default:
+		return 0;
+	}
+}
+
+int main(int argc, char **argv)
+{
+	static uint8_t table[TABLE_SIZE];
+	uint32_t count[4] = {0}, mismatch = 0;
+
+	if (argc < 3)
+	{
+		fprintf(stderr, "usage: %s table_data.h database.bin\n", argv[0]);
+		return 1;
+	}
+
+	walk_forward(0, 0);
+	walk_backward();
+
+	for (uint16_t index = 0; index < SLOT_TOTAL; index++)
+	{
+		uint16_t own, other;
+		int plies, result;
+
+		if (!reachable[index])
+		{
+			continue;
+		}
+
+		decode(index, &own, &other);
+		result = minmax(own, other, &plies);
+		count[value[index]]++;
+
+		if (result != ((value[index] == VALUE_WIN) ? 1 : (value[index] == VALUE_LOSE) ? -1 : 0) || (result && plies != distance[index]))
+		{
+			mismatch++;
+			fprintf(stderr, "mismatch own 0x%03X other 0x%03X\n", own, other);
+		}
+	}
+
+	fprintf(stderr, "%u positions: %u win, %u tie, %u lose, %u mismatch with minmax\n", count[1] + count[2] + count[3], count[1], count[2], count[3], mismatch);
+
+	if (mismatch)
+	{
+		return 1;
+	}
+
+	for (uint16_t index = 0; index < SLOT_TOTAL; index++)
+	{
+		table[index / 2] |= nibble(index) << ((index & 1) ? 4 : 0);
+	}
+
+	FILE *file = fopen(argv[1], "w");
+
+	fprintf(file, "/**\n");
+	fprintf(file, "  * @file      EE33_RetroTable_data.h\n");
+	fprintf(file, "  * @brief     Generated by extras/tools/retro_gen.cpp, do not edit.\n");
+	fprintf(file, "  * @copyright GPL v3.0\n");
+	fprintf(file, "  */\n\n");
+	fprintf(file, "#ifndef EE33_RETRO_TABLE_DATA_H\n");
+	fprintf(file, "#define EE33_RETRO_TABLE_DATA_H\n\n");
+	fprintf(file, "#if RETRO_TABLE_SIZE != %d\n", TABLE_SIZE);
+	fprintf(file, "#error \"RETRO_TABLE_SIZE does not match the generated table\"\n");
+	fprintf(file, "#endif\n\n");
+	fprintf(file, "/** code of ternary index n is in nibble n, low nibble first */\n");
+	fprintf(file, "const uint8_t retro_table[RETRO_TABLE_SIZE] PROGMEM =\n{\n");
+
+	for (int i = 0; i < TABLE_SIZE; i++)
+	{
+		fprintf(file, "%s0x%02X,%s", (i % 16) ? " " : "\t", table[i], (i % 16 == 15 || i == TABLE_SIZE - 1) ? "\n" : "");
+	}
+
+	fprintf(file, "};\n\n");
+	fprintf(file, "#endif  //EE33_RETRO_TABLE_DATA_H\n");
+	fclose(file);
+
+	T_RETRO_FILE_HEADER header = {"EE33RTB", SLOT_TOTAL, sizeof(T_RETRO_FILE_HEADER)};
+
+	file = fopen(argv[2], "wb");
+	fwrite(&header, sizeof(header), 1, file);
+	fwrite(table, sizeof(table), 1, file);
+	fclose(file);
+
+	//map the file back, it must read the same as the table
+	int fd = open(argv[2], O_RDONLY);
+	const uint8_t *map = (const uint8_t *)mmap(NULL, sizeof(header) + sizeof(table), PROT_READ, MAP_PRIVATE, fd, 0);
+	const T_RETRO_FILE_HEADER *p_header = (const T_RETRO_FILE_HEADER *)map;
+
+	if (map == MAP_FAILED || memcmp(p_header->magic, "EE33RTB", 8) || p_header->slot_total != SLOT_TOTAL || memcmp(map + p_header->offset, table, sizeof(table)))
+	{
+		fprintf(stderr, "%s does not read back\n", argv[2]);
+		return 1;
+	}
+
+	munmap((void *)map, sizeof(header) + sizeof(table));
+	close(fd);
+
+	fprintf(stderr, "%d bytes table, %s and %s written\n", TABLE_SIZE, argv[1], argv[2]);
+
+	return 0;
+}
+
+
+/*
+ * @release note
+ * | v1.0 2026-10-16 - 3lectron3ats : Initial Release
+ * #
+*/
@@ -0,0 +1,138 @@
+/**
+  * @file      score_all_check.cpp
+  * @version   v1.0
+  * @author    3lectron3ats <3lectron3ats@gmail.com>
+  * @date      2026.10.16
+  * @brief     Host tool, check MinmaxEngine::ScoreAllMoves against a plain minmax.
+  * @copyright GPL v3.0
+  * *************************************************************************************
+  * @attention
+  * <h2><center>&copy; COPYRIGHT 2023 3lectron3ats </center></h2>
+  * *************************************************************************************
+  * @note
+  *   For every position of a real game with friend to move, each of the 9 scores must
+  *   be the score of a recursive minmax without pruning, cache, symmetry or move
+  *   order, which is written here on its own line table. Occupied positions must be
+  *   MINMAX_SCORE_NONE, and the returned mask must be the moves of the best score.
+  *   It runs once for each move order, with the cache carried from position to
+  *   position as in a game.
+  *   Build and run:
+  *       g++ -O2 -fpermissive -w -DARDUINO=100 -DEE33_HOST_BUILD -Iextras/host -Isrc
+  *           -o score_all_check extras/tools/score_all_check.cpp
+  *           src/EE33_Minmax.cpp src/EE33_MinmaxCache.cpp src/EE33_Matrix.cpp src/EE33_Symmetry.cpp
+  *       ./score_all_check
+  */
+
+#include <EE33_Tic_Tac_Toe.h>
+#include <EE33_Minmax.h>
+
+MinmaxEngine engine;
+
+static const uint16_t line_mask[LINE_SEQ_TOTAL] = {0x07, 0x38, 0x1C0, 0x49, 0x92, 0x124, 0x111, 0x54};
+
+static int8_t line_count(uint16_t map)
+{
+	int8_t count = 0;
+
+	for (uint8_t i = 0; i < LINE_SEQ_TOTAL; i++)
+	{
+		count += ((map & line_mask[i]) == line_mask[i]) ? 1 : 0;
+	}
+
+	return count;
+}
+
+/** score in view of own, own is to move */
+static int8_t plain_minmax(uint16_t own, uint16_t other)
+{
+	int8_t score = MINMAX_SCORE_LINE * (line_count(own) - line_count(other));
+	int8_t best = -MINMAX_SCORE_INFINITE;
+
+	if (score || (own | other) == MATRIX_3X3_MASK)
+	{
+		return score;
+	}
+
+	for (uint8_t i = 0; i < MATRIX_3X3_ELEMENT_TOTAL; i++)
+	{
+		if (!((own | other) & bit(i)))
+		{
+			score = -plain_minmax(other, own | bit(i));
+			best = (score > best) ? score : best;
+		}
+	}
+
+	return best;
+}
+
+int main(void)
+{
+	uint32_t checked = 0, mismatch = 0;
+
+	for (uint8_t order = MINMAX_ORDER_INDEX; order <= MINMAX_ORDER_HEURISTIC; order++)
+	{
+		engine.flush();
+		engine.set_MoveOrder((MINMAX_MOVE_ORDER)order);
+
+		for (uint16_t code = 0; code < 19683; code++)
+		{
+			T_MATRIX_3X3 map_friend = {0}, map_enmy = {0};
+			int8_t scores[MATRIX_3X3_ELEMENT_TOTAL], expect[MATRIX_3X3_ELEMENT_TOTAL], best = MINMAX_SCORE_NONE;
+			uint16_t digits = code, moves, expect_moves = 0;
+			int8_t diff;
+
+			for (uint8_t i = 0; i < MATRIX_3X3_ELEMENT_TOTAL; i++, digits /= 3)
+			{
+				map_friend.d16 |= (digits % 3 == 1) ? bit(i) : 0;
+				map_enmy.d16 |= (digits % 3 == 2) ? bit(i) : 0;
+			}
+
+			//friend to move, nobody won and friend has a move
+			diff = (int8_t)MatrixBit::count(map_enmy.d16) - (int8_t)MatrixBit::count(map_friend.d16);
+
+			if ((diff != 0 && diff != 1) || line_count(map_friend.d16) || line_count(map_enmy.d16) || MatrixBit::Is_Full(map_friend, map_enmy))
+			{
+				continue;
+			}
+
+			for (uint8_t i = 0; i < MATRIX_3X3_ELEMENT_TOTAL; i++)
+			{
+				expect[i] = MINMAX_SCORE_NONE;
+
+				if (!((map_friend.d16 | map_enmy.d16) & bit(i)))
+				{
+					expect[i] = -plain_minmax(map_enmy.d16, map_friend.d16 | bit(i));
+					expect_moves = (expect[i] > best) ? 0 : expect_moves;
+					best = (expect[i] > best) ? expect[i] : best;
+					expect_moves |= (expect[i] == best) ? bit(i) : 0;
+				}
+			}
+
+			moves = engine.ScoreAllMoves(map_friend, map_enmy, MatrixHash::hash(map_friend, map_enmy, PLAYER_TYPE_FRIEND), scores);
+
+			checked++;
+
+			if (memcmp(scores, expect, sizeof(scores)) || moves != expect_moves)
+			{
+				mismatch++;
+				printf("mismatch order %u friend 0x%03X enmy 0x%03X: moves 0x%03X, minmax 0x%03X\n", order, map_friend.d16, map_enmy.d16, moves, expect_moves);
+
+				for (uint8_t i = 0; i < MATRIX_3X3_ELEMENT_TOTAL; i++)
+				{
+					printf("  %u: %4d %4d\n", i, scores[i], expect[i]);
+				}
+			}
+		}
+	}
+
+	printf("%u positions checked, both move orders, %u mismatch\n", checked, mismatch);
+
+	return mismatch ? 1 : 0;
+}
+
+
+/*
+ * @release note
+ * | v1.0 2026-10-16 - 3lectron3ats : Initial Release
+ * #
+*/
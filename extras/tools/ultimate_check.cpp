@@ -0,0 +1,224 @@
+/**
+  * @file      ultimate_check.cpp
+  * @version   v1.0
+  * @author    3lectron3ats <3lectron3ats@gmail.com>
+  * @date      2026.10.16
+  * @brief     Host tool, check UltimateBoard and let its engine play.
+  * @copyright GPL v3.0
+  * *************************************************************************************
+  * @attention
+  * <h2><center>&copy; COPYRIGHT 2023 3lectron3ats </center></h2>
+  * *************************************************************************************
+  * @note
+  *   Random games are played; after every move the score kept piece by piece is
+  *   compared with a score calculated from scratch, the cursor must walk exactly the
+  *   legal cells, and a search must leave the board as it was.
+  *   Then the engine plays against random moves and against itself with a time budget.
+  *   Build and run:
+  *       g++ -O2 -fpermissive -w -DARDUINO=100 -DEE33_HOST_BUILD -Iextras/host -Isrc
+  *           -o ultimate_check extras/tools/ultimate_check.cpp src/EE33_Ultimate.cpp src/EE33_Matrix.cpp
+  *       ./ultimate_check
+  */
+
+#include <EE33_Tic_Tac_Toe.h>
+#include <EE33_Ultimate.h>
+
+/** pieces on lines without other pieces, n in a line count n * n * weight */
+static int16_t line_score(uint16_t own, uint16_t other, uint16_t blocked, int16_t weight)
+{
+	int16_t score = 0;
+
+	for (uint8_t line = LINE_1; line < LINE_SEQ_TOTAL; line++)
+	{
+		uint16_t mask = MatrixLine::get_LineMask((LINE_SEQUENCE)line);
+		int16_t own_count = __builtin_popcount(own & mask), other_count = __builtin_popcount(other & mask);
+
+		if (blocked & mask)
+		{
+			continue;
+		}
+
+		if (!other_count)
+		{
+			score += own_count * own_count * weight;
+		}
+		else if (!own_count)
+		{
+			score -= other_count * other_count * weight;
+		}
+	}
+
+	return score;
+}
+
+/** score in view of friend from scratch, -32768 if meta-board does not match sub-boards */
+static int16_t score_of(UltimateBoard &board)
+{
+	uint16_t won[2] = {0, 0}, drawn = 0;
+	int16_t score = 0;
+
+	for (uint8_t i = 0; i < ULTIMATE_BOARD_TOTAL; i++)
+	{
+		T_MATRIX_3X3 own = board.get_SubMap(i, PLAYER_TYPE_FRIEND), other = board.get_SubMap(i, PLAYER_TYPE_ENMY);
+
+		if (MatrixLine::Is_Bingo(own))
+		{
+			won[PLAYER_TYPE_FRIEND] |= bit(i);
+			score += ULTIMATE_SCORE_BOARD;
+		}
+		else if (MatrixLine::Is_Bingo(other))
+		{
+			won[PLAYER_TYPE_ENMY] |= bit(i);
+			score -= ULTIMATE_SCORE_BOARD;
+		}
+		else if ((own.d16 | other.d16) == MATRIX_3X3_MASK)
+		{
+			drawn |= bit(i);
+		}
+		else
+		{
+			score += line_score(own.d16, other.d16, 0, 1);
+		}
+	}
+
+	if (won[PLAYER_TYPE_FRIEND] != board.get_MetaMap(PLAYER_TYPE_FRIEND).d16 || won[PLAYER_TYPE_ENMY] != board.get_MetaMap(PLAYER_TYPE_ENMY).d16)
+	{
+		return INT16_MIN;
+	}
+
+	//a drawn sub-board blocks the line for both
+	return score + line_score(won[PLAYER_TYPE_FRIEND], won[PLAYER_TYPE_ENMY], drawn, ULTIMATE_SCORE_BOARD);
+}
+
+static bool check_cursor(UltimateBoard &board)
+{
+	uint8_t legal = 0, walked = 0, cursor, first;
+
+	for (uint8_t i = 0; i < ULTIMATE_CELL_TOTAL; i++)
+	{
+		legal += board.Is_Legal(i);
+	}
+
+	first = cursor = board.find_IdleLed_Forward(ULTIMATE_CELL_NONE);
+
+	while (cursor != ULTIMATE_CELL_NONE)
+	{
+		walked++;
+		cursor = board.find_IdleLed_Forward(cursor);
+
+		if (cursor == first)
+		{
+			break;
+		}
+	}
+
+	return legal == walked && board.find_IdleLed_Backword(board.find_IdleLed_Forward(first)) == first;
+}
+
+static uint8_t random_move(UltimateBoard &board)
+{
+	return board.find_IdleLed_Forward(random(ULTIMATE_CELL_TOTAL));
+}
+
+static uint32_t check_random(uint16_t games)
+{
+	uint32_t moves = 0, mismatch = 0;
+
+	for (uint16_t game = 0; game < games; game++)
+	{
+		UltimateBoard board;
+		PLAYER_TYPE player = PLAYER_TYPE_FRIEND;
+
+		while (!board.Is_Over())
+		{
+			board.set_Cell(random_move(board), player);
+			moves++;
+
+			if (score_of(board) != board.get_Score() || !check_cursor(board))
+			{
+				mismatch++;
+			}
+
+			//a search every few moves, it must take back what it tried
+			if (!(moves % 8) && !board.Is_Over())
+			{
+				int16_t score = board.get_Score();
+				uint8_t next = board.get_NextBoard();
+
+				board.BestNextMove(player, 2000);
+
+				if (board.get_Score() != score || board.get_NextBoard() != next || score_of(board) != score)
+				{
+					mismatch++;
+				}
+			}
+
+			player = (player == PLAYER_TYPE_FRIEND) ? PLAYER_TYPE_ENMY : PLAYER_TYPE_FRIEND;
+		}
+	}
+
+	printf("UltimateBoard: %u random games, %u moves checked, %u mismatch\n", games, moves, mismatch);
+
+	return mismatch;
+}
+
+static void play_random(uint8_t games, uint32_t budget_us)
+{
+	uint8_t win = 0, tie = 0, lose = 0;
+
+	for (uint8_t game = 0; game < games; game++)
+	{
+		UltimateBoard board;
+		//engine is friend, it goes first in even games
+		PLAYER_TYPE player = (game & 1) ? PLAYER_TYPE_ENMY : PLAYER_TYPE_FRIEND;
+
+		while (!board.Is_Over())
+		{
+			board.set_Cell((player == PLAYER_TYPE_FRIEND) ? board.BestNextMove(player, budget_us) : random_move(board), player);
+			player = (player == PLAYER_TYPE_FRIEND) ? PLAYER_TYPE_ENMY : PLAYER_TYPE_FRIEND;
+		}
+
+		win += board.Is_Bingo(PLAYER_TYPE_FRIEND);
+		lose += board.Is_Bingo(PLAYER_TYPE_ENMY);
+		tie += !board.Is_Bingo(PLAYER_TYPE_FRIEND) && !board.Is_Bingo(PLAYER_TYPE_ENMY);
+	}
+
+	printf("UltimateBoard against random moves, %lu us per move: %u win, %u tie, %u lose\n", (unsigned long)budget_us, win, tie, lose);
+}
+
+static void self_play(uint32_t budget_us)
+{
+	UltimateBoard board;
+	PLAYER_TYPE player = PLAYER_TYPE_FRIEND;
+	uint8_t moves = 0;
+	unsigned long start = micros();
+
+	printf("UltimateBoard: %u bytes object, %u bytes stack, %lu us per move\n", (unsigned)sizeof(UltimateBoard), UltimateBoard::get_SearchStackSize(), (unsigned long)budget_us);
+
+	while (!board.Is_Over())
+	{
+		board.set_Cell(board.BestNextMove(player, budget_us), player);
+		player = (player == PLAYER_TYPE_FRIEND) ? PLAYER_TYPE_ENMY : PLAYER_TYPE_FRIEND;
+		moves++;
+	}
+
+	printf("  %s after %u moves, %u nodes in %lu us\n", board.Is_Bingo(PLAYER_TYPE_FRIEND) ? "X wins" : board.Is_Bingo(PLAYER_TYPE_ENMY) ? "O wins" : "tie",
+		moves, board.get_SearchNode(), micros() - start);
+}
+
+int main(void)
+{
+	uint32_t mismatch = check_random(200);
+
+	play_random(10, 20000);
+	self_play(100000);
+
+	return mismatch ? 1 : 0;
+}
+
+
+/*
+ * @release note
+ * | v1.0 2026-10-16 - 3lectron3ats : Initial Release
+ * #
+*/
@@ -0,0 +1,651 @@
+/**
+  * @file      EE33_Board.h
+  * @version   v1.0
+  * @author    3lectron3ats <3lectron3ats@gmail.com>
+  * @date      2026.10.16
+  * @brief     m,n,k board and search engine, K in a row on M rows x N columns.
+  * @copyright GPL v3.0
+  * *************************************************************************************
+  * @attention
+  * <h2><center>&copy; COPYRIGHT 2023 3lectron3ats </center></h2>
+  * *************************************************************************************
+  * @note
+  *   Cell n is row (n / N), column (n % N), same order as MATRIX_3X3_ELEMENT on 3x3.
+  *   Bitmap is uint16_t up to 16 cells, uint32_t up to 32 cells, uint64_t up to 64.
+  *   Line masks and move order are generated by the constructor, so nothing has to be
+  *   written by hand for a new size. They stay in SRAM, 4x4 takes 20 bytes and 5x5
+  *   with 4 in a row takes 112 bytes.
+  *   Search is negamax alpha-beta on an explicit stack of D frames, D is the
+  *   deepest ply searched(whole game up to 16 cells, 8 plies on bigger boards).
+  *   Positions at the search horizon are guessed by open lines.
+  *   An opening book made by extras/tools/board_solver.cpp -b is used by set_Book, its
+  *   positions are played from flash without search.
+  * @par    sample code
+  * @code
+  *       Board<4, 4, 4> board;
+  *
+  *       board.set_Cell(Board<4, 4, 4>::cell(1, 1), PLAYER_TYPE_ENMY);
+  *       next_step = board.BestNextMove(PLAYER_TYPE_FRIEND, 200000);
+  * @endcode
+  */
+
+
+#ifndef EE33_BOARD_H
+#define EE33_BOARD_H
+
+// Arduino versioning.
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "Arduino.h"	// for digitalRead, digitalWrite, etc
+#else
+#include "WProgram.h"
+#endif
+
+#include <EE33_Matrix.h>
+
+#define BOARD_VERSION_MAJOR  1
+#define BOARD_VERSION_MINOR  0
+
+/** score of a win, quicker win gets a little more */
+#define BOARD_SCORE_WIN           10000
+
+/** bigger than any score, bound of the full alpha-beta window */
+#define BOARD_SCORE_INFINITE      0x7FFF
+
+/** no cell, matrix full */
+#define BOARD_CELL_NONE           0xFF
+
+/** nodes between two checks of the time budget, must be power of 2 */
+#define BOARD_TIME_CHECK_NODES    64
+
+/*! select T_SMALL if FIT, otherwise T_BIG */
+template <bool FIT, typename T_SMALL, typename T_BIG>
+struct BoardTypeSelect
+{
+	typedef T_SMALL type;
+};
+
+template <typename T_SMALL, typename T_BIG>
+struct BoardTypeSelect<false, T_SMALL, T_BIG>
+{
+	typedef T_BIG type;
+};
+
+/*! smallest unsigned integer with CELLS bits */
+template <uint8_t CELLS>
+struct BoardBitmap
+{
+	typedef typename BoardTypeSelect<(CELLS <= 16), uint16_t,
+	        typename BoardTypeSelect<(CELLS <= 32), uint32_t, uint64_t>::type>::type type;
+};
+
+template <uint8_t M, uint8_t N, uint8_t K, uint8_t D = ((M * N <= 16) ? M * N : 8)>
+class Board
+{
+public:
+
+	typedef typename BoardBitmap<M * N>::type T_BITMAP;
+
+	/*! key of opening book, friend(the one to move) | enmy << CELL_TOTAL */
+	typedef typename BoardBitmap<2 * M * N>::type T_BOOK_KEY;
+
+	static const uint8_t ROW = M;
+	static const uint8_t COLUMN = N;
+	static const uint8_t LINE_LENGTH = K;
+	static const uint8_t CELL_TOTAL = M * N;
+	static const uint8_t LINE_TOTAL = M * (N - K + 1) + N * (M - K + 1) + 2 * (M - K + 1) * (N - K + 1);
+	static const uint8_t SEARCH_DEPTH = (D < M * N) ? D : M * N;
+
+	static_assert(M * N <= 64, "board is bigger than 64 cells");
+	static_assert(K >= 2 && K <= M && K <= N, "line length must fit in rows and columns");
+	static_assert(LINE_TOTAL * (K - 1) < BOARD_SCORE_WIN - M * N, "open line score reaches win score");
+
+/**
+	* @brief  construction, generate line masks and move order, board is empty
+	*/
+	Board()
+	{
+		uint8_t line = 0;
+		uint8_t weight[CELL_TOTAL];
+
+		//start cell and step of row, column, diagonal and anti-diagonal lines
+		for (uint8_t dir = 0; dir < 4; dir++)
+		{
+			int8_t step_row = (dir == 0) ? 0 : 1;
+			int8_t step_column = (dir == 1) ? 0 : (dir == 3) ? -1 : 1;
+
+			for (uint8_t row = 0; row < M; row++)
+			{
+				for (uint8_t column = 0; column < N; column++)
+				{
+					int8_t end_row = row + step_row * (K - 1);
+					int8_t end_column = column + step_column * (K - 1);
+
+					if (end_row >= M || end_column < 0 || end_column >= N)
+					{
+						continue;
+					}
+
+					line_mask[line] = 0;
+
+					for (uint8_t i = 0; i < K; i++)
+					{
+						line_mask[line] |= _bit(cell(row + step_row * i, column + step_column * i));
+					}
+
+					line++;
+				}
+			}
+		}
+
+		//cells on more lines first, center before edge
+		for (uint8_t i = 0; i < CELL_TOTAL; i++)
+		{
+			weight[i] = 0;
+
+			for (line = 0; line < LINE_TOTAL; line++)
+			{
+				weight[i] += (line_mask[line] & _bit(i)) ? 1 : 0;
+			}
+
+			move_order[i] = i;
+		}
+
+		for (uint8_t i = 1; i < CELL_TOTAL; i++)
+		{
+			for (uint8_t j = i; j > 0 && weight[move_order[j]] > weight[move_order[j - 1]]; j--)
+			{
+				uint8_t tmp = move_order[j];
+
+				move_order[j] = move_order[j - 1];
+				move_order[j - 1] = tmp;
+			}
+		}
+
+		clear();
+		reset_SearchNode();
+		book_key = NULL;
+		book_move = NULL;
+		book_size = 0;
+		search_budget_us = 0;
+		search_abort = false;
+	}
+
+/**
+	* @brief  cell number of row and column
+	* @param  row 0 ~ M - 1
+	* @param  column 0 ~ N - 1
+	* @return cell
+	*/
+	static uint8_t cell(uint8_t row, uint8_t column)
+	{
+		return row * N + column;
+	}
+
+/**
+	* @brief  remove all pieces
+	*/
+	void clear(void)
+	{
+		map[PLAYER_TYPE_FRIEND] = 0;
+		map[PLAYER_TYPE_ENMY] = 0;
+	}
+
+/**
+	* @brief  put piece on cell
+	* @param  cell
+	* @param  player
+	* @retval true done
+	* @retval false cell is out of board or taken
+	*/
+	bool set_Cell(uint8_t cell, PLAYER_TYPE player)
+	{
+		if (cell >= CELL_TOTAL || ((map[PLAYER_TYPE_FRIEND] | map[PLAYER_TYPE_ENMY]) & _bit(cell)))
+		{
+			return false;
+		}
+
+		map[player] |= _bit(cell);
+
+		return true;
+	}
+
+/**
+	* @brief  remove piece from cell
+	* @param  cell
+	*/
+	void clear_Cell(uint8_t cell)
+	{
+		map[PLAYER_TYPE_FRIEND] &= ~_bit(cell);
+		map[PLAYER_TYPE_ENMY] &= ~_bit(cell);
+	}
+
+/**
+	* @brief  get pieces of player
+	* @param  player
+	* @return bit n set means cell n is taken by player
+	*/
+	T_BITMAP get_Map(PLAYER_TYPE player)
+	{
+		return map[player];
+	}
+
+/**
+	* @brief  get cells of line
+	* @param  line 0 ~ LINE_TOTAL - 1, rows, columns, diagonals then anti-diagonals
+	* @return bit n set means cell n is on the line
+	*/
+	T_BITMAP get_Line(uint8_t line)
+	{
+		return line_mask[line];
+	}
+
+/**
+	* @brief  player has K in a line or not
+	* @param  player
+	* @retval true at least one line is bingo
+	* @retval false no bingo line
+	*/
+	bool Is_Bingo(PLAYER_TYPE player)
+	{
+		return _is_bingo(map[player]);
+	}
+
+/**
+	* @brief  board is full or not
+	* @retval true no empty cell
+	* @retval false at least one empty cell
+	*/
+	bool Is_Full(void)
+	{
+		return (map[PLAYER_TYPE_FRIEND] | map[PLAYER_TYPE_ENMY]) == _full();
+	}
+
+/**
+	* @brief  use an opening book made by extras/tools/board_solver.cpp -b
+	* @param  key book_MxNxK_key in flash, sorted
+	* @param  move book_MxNxK_move in flash, best moves of each key
+	* @param  size BOOK_MxNxK_SIZE, 0 means no book, 0x7FFF at most
+	* @note   positions in book are played without search, by get_BookMoves
+	*/
+	void set_Book(const T_BOOK_KEY *key, const T_BITMAP *move, uint16_t size)
+	{
+		static_assert(2 * M * N <= 64, "book key of board bigger than 32 cells does not fit");
+
+		book_key = key;
+		book_move = move;
+		book_size = size;
+	}
+
+/**
+	* @brief  read the best moves of player from opening book
+	* @param  player the one to move
+	* @return bit n set means cell n is a best move, 0 means position is not in book
+	* @note   book moves are solved by win, tie or lose only, a quicker win is not
+	*         preferred
+	*/
+	T_BITMAP get_BookMoves(PLAYER_TYPE player)
+	{
+		T_BITMAP other = map[(player == PLAYER_TYPE_FRIEND) ? PLAYER_TYPE_ENMY : PLAYER_TYPE_FRIEND];
+		T_BOOK_KEY key = (T_BOOK_KEY)map[player] | ((T_BOOK_KEY)other << (CELL_TOTAL % 64));  //64 cells has no book
+		int16_t low = 0, high = (int16_t)book_size - 1;
+
+		while (low <= high)
+		{
+			int16_t middle = (low + high) / 2;
+			T_BOOK_KEY middle_key;
+
+			memcpy_P(&middle_key, &book_key[middle], sizeof(middle_key));
+
+			if (middle_key == key)
+			{
+				T_BITMAP moves;
+
+				memcpy_P(&moves, &book_move[middle], sizeof(moves));
+
+				return moves;
+			}
+
+			if (middle_key < key)
+			{
+				low = middle + 1;
+			}
+			else
+			{
+				high = middle - 1;
+			}
+		}
+
+		return 0;
+	}
+
+/**
+	* @brief  calculate the next step of player
+	* @param  player the one to move
+	* @param  budget_us time limit in microseconds, 0 means search SEARCH_DEPTH plies
+	* @return cell, BOARD_CELL_NONE means board full
+	* @note   with budget, search goes one ply deeper each round and the best move of
+	*         the last finished round is taken. Moves of the same score are picked
+	*         randomly. Position in opening book(set_Book) takes the book moves
+	*         without search.
+	*/
+	uint8_t BestNextMove(PLAYER_TYPE player, uint32_t budget_us = 0)
+	{
+		T_BITMAP own = map[player];
+		T_BITMAP other = map[(player == PLAYER_TYPE_FRIEND) ? PLAYER_TYPE_ENMY : PLAYER_TYPE_FRIEND];
+		T_BITMAP BestMoves, moves;
+
+		if ((own | other) == _full())
+		{
+			return BOARD_CELL_NONE;
+		}
+
+		BestMoves = get_BookMoves(player);
+
+		if (!BestMoves)
+		{
+			search_abort = false;
+			search_budget_us = 0;  //first round is never stopped, there must be a move
+			search_start_us = micros();
+
+			for (search_horizon = (budget_us) ? 1 : SEARCH_DEPTH; search_horizon <= SEARCH_DEPTH; search_horizon++)
+			{
+				moves = _search_root(own, other);
+
+				if (search_abort)
+				{
+					break;
+				}
+
+				BestMoves = moves;
+				search_budget_us = budget_us;
+			}
+		}
+
+		int32_t NextMoveChoose = (int32_t)random(_popcount(BestMoves));
+
+		for (uint8_t i = 0; i < CELL_TOTAL; i++)
+		{
+			if ((BestMoves & _bit(i)) && NextMoveChoose-- == 0)
+			{
+				return i;
+			}
+		}
+
+		return BOARD_CELL_NONE;
+	}
+
+/**
+	* @brief  get positions visited by search
+	* @return node counter, it keeps adding up until reset_SearchNode
+	*/
+	uint32_t get_SearchNode(void)
+	{
+		return search_node;
+	}
+
+/**
+	* @brief  clear node counter
+	*/
+	void reset_SearchNode(void)
+	{
+		search_node = 0;
+	}
+
+/**
+	* @brief  get SRAM bytes of search stack
+	* @return bytes, the worst case of any search
+	*/
+	static uint16_t get_SearchStackSize(void)
+	{
+		return sizeof(T_BOARD_FRAME) * SEARCH_DEPTH;
+	}
+
+private:
+
+	/*! one position of the search, maps and score in view of the one to move */
+	typedef struct
+	{
+		T_BITMAP map_own;
+		T_BITMAP map_other;
+		T_BITMAP remaining;    /*!< moves not searched yet */
+		uint8_t  move;         /*!< move being searched */
+		uint8_t  ply;          /*!< plies from root */
+		int16_t  alpha;
+		int16_t  beta;
+		int16_t  best;         /*!< best score of searched moves */
+	} T_BOARD_FRAME;
+
+	static T_BITMAP _bit(uint8_t cell)
+	{
+		return (T_BITMAP)1 << cell;
+	}
+
+	static T_BITMAP _full(void)
+	{
+		return (T_BITMAP)((T_BITMAP)~(T_BITMAP)0 >> (sizeof(T_BITMAP) * 8 - CELL_TOTAL));
+	}
+
+	static uint8_t _popcount(T_BITMAP n)
+	{
+		uint8_t count = 0;
+
+		for (; n; n &= n - 1, count++);
+
+		return count;
+	}
+
+	bool _is_bingo(T_BITMAP MatrixMap)
+	{
+		for (uint8_t line = 0; line < LINE_TOTAL; line++)
+		{
+			if ((MatrixMap & line_mask[line]) == line_mask[line])
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+/**
+	* @brief  guess score at search horizon
+	* @return pieces on lines without other pieces, own minus other
+	*/
+	int16_t _evaluate(T_BITMAP own, T_BITMAP other)
+	{
+		int16_t score = 0;
+
+		for (uint8_t line = 0; line < LINE_TOTAL; line++)
+		{
+			if (!(other & line_mask[line]))
+			{
+				score += _popcount(own & line_mask[line]);
+			}
+			else if (!(own & line_mask[line]))
+			{
+				score -= _popcount(other & line_mask[line]);
+			}
+		}
+
+		return score;
+	}
+
+/**
+	* @brief  set up the frame of a position, score it at once if game over or horizon
+	* @note   frame without remaining moves is done, its score is frame->best
+	*/
+	void _search_enter(T_BOARD_FRAME *frame, T_BITMAP own, T_BITMAP other, int16_t alpha, int16_t beta, uint8_t ply)
+	{
+		search_node++;
+
+		if (search_budget_us && !(search_node & (BOARD_TIME_CHECK_NODES - 1)) && micros() - search_start_us >= search_budget_us)
+		{
+			search_abort = true;
+		}
+
+		frame->map_own = own;
+		frame->map_other = other;
+		frame->ply = ply;
+		frame->remaining = 0;
+
+		if (_is_bingo(other))
+		{
+			//the other one just won, quicker win is worse for us
+			frame->best = -(BOARD_SCORE_WIN - ply);
+		}
+		else if ((own | other) == _full())
+		{
+			frame->best = 0;
+		}
+		else if (ply >= search_horizon)
+		{
+			frame->best = _evaluate(own, other);
+		}
+		else
+		{
+			frame->remaining = ~(own | other) & _full();
+			frame->alpha = alpha;
+			frame->beta = beta;
+			frame->best = -BOARD_SCORE_INFINITE;
+		}
+	}
+
+/**
+	* @brief  score of position in view of the one to move
+	*/
+	int16_t _search(T_BITMAP own, T_BITMAP other, int16_t alpha, int16_t beta)
+	{
+		T_BOARD_FRAME *frame = &search_stack[0];
+		int16_t score;
+
+		_search_enter(frame, own, other, alpha, beta, 1);
+
+		while (!search_abort)
+		{
+			if (frame->remaining)
+			{
+				uint8_t i;
+
+				for (i = 0; !(frame->remaining & _bit(move_order[i])); i++);
+
+				frame->move = move_order[i];
+				frame->remaining &= ~_bit(frame->move);
+
+				_search_enter(frame + 1, frame->map_other, frame->map_own | _bit(frame->move), -frame->beta, -frame->alpha, frame->ply + 1);
+
+				frame++;
+				continue;
+			}
+
+			score = frame->best;
+
+			if (frame == &search_stack[0])
+			{
+				return score;
+			}
+
+			frame--;
+			score = -score;
+
+			frame->best = (score > frame->best) ? score : frame->best;
+			frame->alpha = (score > frame->alpha) ? score : frame->alpha;
+
+			if (frame->beta <= frame->alpha)
+			{
+				frame->remaining = 0;
+			}
+		}
+
+		return 0;  //out of time, caller drops the score
+	}
+
+/**
+	* @brief  search all the moves of root until search_horizon
+	* @return mask of best moves, not valid if search_abort is set
+	*/
+	T_BITMAP _search_root(T_BITMAP own, T_BITMAP other)
+	{
+		T_BITMAP BestMoves = 0;
+		int16_t ScoreMax = -BOARD_SCORE_INFINITE;
+
+		for (uint8_t i = 0; i < CELL_TOTAL && !search_abort; i++)
+		{
+			uint8_t move = move_order[i];
+			int16_t score;
+
+			if ((own | other) & _bit(move))
+			{
+				continue;
+			}
+
+			if (ScoreMax == -BOARD_SCORE_INFINITE)
+			{
+				score = -_search(other, own | _bit(move), -BOARD_SCORE_INFINITE, BOARD_SCORE_INFINITE);
+			}
+			else
+			{
+				//only best score is inside the window, so a score inside is an exact tie
+				score = -_search(other, own | _bit(move), -(ScoreMax + 1), -(ScoreMax - 1));
+
+				if (score > ScoreMax)
+				{
+					//better, get the exact score
+					score = -_search(other, own | _bit(move), -BOARD_SCORE_INFINITE, -ScoreMax);
+				}
+			}
+
+			if (score > ScoreMax)
+			{
+				ScoreMax = score;
+				BestMoves = _bit(move);
+			}
+			else if (score == ScoreMax)
+			{
+				BestMoves |= _bit(move);
+			}
+		}
+
+		return BestMoves;
+	}
+
+	/** pieces of friend and enmy */
+	T_BITMAP map[PLAYER_TYPE_MAX + 1];
+
+	/** cells of every line */
+	T_BITMAP line_mask[LINE_TOTAL];
+
+	/** cells in the order tried by search */
+	uint8_t move_order[CELL_TOTAL];
+
+	/** opening book in flash, sorted keys and best moves of each */
+	const T_BOOK_KEY *book_key;
+	const T_BITMAP *book_move;
+	uint16_t book_size;
+
+	/** frames of search, index is ply from root minus 1 */
+	T_BOARD_FRAME search_stack[SEARCH_DEPTH];
+
+	/** positions this many plies from root are guessed instead of searched */
+	uint8_t search_horizon;
+
+	/** search is out of time, result is not valid */
+	bool search_abort;
+
+	/** positions visited by search */
+	uint32_t search_node;
+
+	/** time limit of search, 0 means no limit */
+	uint32_t search_budget_us;
+
+	/** micros() when search started */
+	uint32_t search_start_us;
+};
+
+#endif  //EE33_BOARD_H
+
+
+/*
+ * @release note
+ * | v1.0 2026-10-16 - 3lectron3ats : Initial Release
+ * #
+*/
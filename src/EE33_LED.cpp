@@ -13,7 +13,8 @@
 
 #include <EE33_Tic_Tac_Toe.h>
 #include <EE33_LED.h>
-#include <EE33_SimpleQueue.h>
+#include <EE33_MoveTable.h>
+#include <EE33_RetroTable.h>
 
 const T_LED_LINE line_list[LINE_SEQ_TOTAL] =
 {
@@ -40,6 +41,7 @@ T_MATRIX_3X3 StraightLine_3X3[LINE_SEQ_TOTAL] =
 };
 
 
+
 LED_SQUARE::LED_SQUARE(byte *color_A_pin, byte *color_B_pin)
 {
 	LED_blink_status = LOW;
@@ -60,7 +62,15 @@ LED_SQUARE::LED_SQUARE(byte *color_A_pin, byte *color_B_pin)
 		p_led->pin = color_B_pin[i];
 		p_led += LED_COLOR_TOTAL;
 	}
-	
+
+	MatrixBitmap[LED_COLOR_A].d16 = 0;
+	MatrixBitmap[LED_COLOR_B].d16 = 0;
+	MatrixBitmapHash[LED_COLOR_A] = 0;
+	MatrixBitmapHash[LED_COLOR_B] = 0;
+	BlinkBitmap[LED_COLOR_A] = 0;
+	BlinkBitmap[LED_COLOR_B] = 0;
+
+	ponder_color = LED_COLOR_TOTAL;
 }
 
 LED_SQUARE::~LED_SQUARE()
@@ -80,6 +90,8 @@ void LED_SQUARE::end(void)
 
 	LED_blink_status = LOW;
 	LED_blink_millis_accumulation = 0;
+
+	minmax_engine.flush();
 }
 
 void LED_SQUARE::set_LEDStatus(LED_SEQUENCE LED_seq, LED_COLOR LED_color, LED_STATUS status)
@@ -88,7 +100,16 @@ void LED_SQUARE::set_LEDStatus(LED_SEQUENCE LED_seq, LED_COLOR LED_color, LED_ST
 	p_led->status = status;
 
 	T_MATRIX_3X3 *bitmap = (T_MATRIX_3X3 *)&MatrixBitmap[LED_color];
-	bitmap->d16 = (status == LED_STATUS_ON) ? bitmap->d16 | bit(LED_seq) : (status == LED_STATUS_OFF) ? bitmap->d16 & ~bit((uint8_t)LED_seq) : bitmap->d16;
+	uint16_t bitmap_old = bitmap->d16;
+	uint16_t mask = MatrixBit::mask((MATRIX_3X3_ELEMENT)LED_seq);
+	bitmap->d16 = (status == LED_STATUS_ON) ? bitmap->d16 | mask : (status == LED_STATUS_OFF) ? bitmap->d16 & ~mask : bitmap->d16;
+	BlinkBitmap[LED_color] = (status == LED_STATUS_BLINK) ? BlinkBitmap[LED_color] | mask : BlinkBitmap[LED_color] & ~mask;
+
+	if (bitmap->d16 != bitmap_old)
+	{
+		//piece put or removed, same key does both
+		MatrixBitmapHash[LED_color] ^= MatrixHash::key(PLAYER_TYPE_FRIEND, (MATRIX_3X3_ELEMENT)LED_seq);
+	}
 
 	if (status == LED_STATUS_OFF || 
 		status == LED_STATUS_ON)
@@ -237,230 +258,149 @@ void LED_SQUARE::_controlLED(byte pin_number, uint8_t status)
 
 LED_SEQUENCE LED_SQUARE::_find_IdleLed(LED_SEQUENCE LED_now, bool is_next)
 {
-	uint8_t color, sequence;
-	LED_SEQUENCE led_position;
-
-	led_position = (is_next) ? SEQUENCE_INCREASE_CYCLE(LED_now) : SEQUENCE_DECREASE_CYCLE(LED_now);
+	uint16_t idle = ~(MatrixBitmap[LED_COLOR_A].d16 | MatrixBitmap[LED_COLOR_B].d16 | BlinkBitmap[LED_COLOR_A] | BlinkBitmap[LED_COLOR_B]) & MATRIX_3X3_MASK;
+	uint16_t now = MatrixBit::mask((MATRIX_3X3_ELEMENT)LED_now);
+	uint16_t ahead;
 
-	for (sequence = 0; sequence < LED_SEQ_TOTAL; sequence++)
+	//idle LEDs after LED_now in the direction, else wrap around, LED_now itself comes last
+	if (is_next)
 	{
-		for (color = 0; color < LED_COLOR_TOTAL; color++)
-		{
-			if (get_LEDStatus(led_position, color) != LED_STATUS_OFF)
-			{
-				break;
-			}
-		}
-
-		if (color == LED_COLOR_TOTAL)
-		{
-		    return led_position;			
-		}
+		ahead = idle & ~((now << 1) - 1);
 
-		led_position = (is_next) ? SEQUENCE_INCREASE_CYCLE(led_position) : SEQUENCE_DECREASE_CYCLE(led_position);
+		return (LED_SEQUENCE)MatrixBit::lowest((ahead) ? ahead : idle);
 	}
 
-	return LED_SEQ_TOTAL;
+	ahead = idle & (now - 1);
+
+	return (LED_SEQUENCE)MatrixBit::highest((ahead) ? ahead : idle);
 }
 
-uint8_t LED_SQUARE::_minmax_popcount(uint32_t n)
+
+LED_SEQUENCE LED_SQUARE::BestNextMove(LED_COLOR LED_color)
 {
-    uint8_t count = 0;
+	return BestNextMove(LED_color, 0);
+}
 
-    while (n)
-    {
-        n &= (n - 1);
-        count++;
-    }
+LED_SEQUENCE LED_SQUARE::BestNextMove(LED_COLOR LED_color, uint32_t budget_us)
+{
+	ponder_color = LED_COLOR_TOTAL;  //engine takes the pondered reply or drops it
 
-    return count;
+	return (LED_SEQUENCE)minmax_engine.BestNextMove(MatrixBitmap[LED_color], MatrixBitmap[COLOR_CYCLE(LED_color)], get_PositionHash(LED_color), budget_us);
 }
 
-int16_t LED_SQUARE::_minmax_cal_score(T_MATRIX_3X3 MatrixMap_Friend, T_MATRIX_3X3 MatrixMap_Enmy)
+uint16_t LED_SQUARE::ScoreAllMoves(LED_COLOR LED_color, int8_t scores[MATRIX_3X3_ELEMENT_TOTAL])
 {
-	int16_t score = 0;
-	uint8_t index;
+	ponder_color = LED_COLOR_TOTAL;  //engine drops the pondered replies
 
-	for (index = 0; index < LINE_SEQ_TOTAL; index++)
-	{
-		score = (_minmax_popcount(MatrixMap_Friend.d16 & StraightLine_3X3[index].d16) == MATRIX_3X3_LENGTH) ? score + 100: score;
-		score = (_minmax_popcount(MatrixMap_Enmy.d16 & StraightLine_3X3[index].d16) == MATRIX_3X3_LENGTH) ? score - 100: score;
-	}
-
-	return score;
+	return minmax_engine.ScoreAllMoves(MatrixBitmap[LED_color], MatrixBitmap[COLOR_CYCLE(LED_color)], get_PositionHash(LED_color), scores);
 }
 
-
-LED_SEQUENCE LED_SQUARE::BestNextMove(LED_COLOR LED_color)
+LED_SEQUENCE LED_SQUARE::BestNextMove_Lookup(LED_COLOR LED_color)
 {
 	T_MATRIX_3X3 map_friend = MatrixBitmap[LED_color];
 	T_MATRIX_3X3 map_enmy = MatrixBitmap[COLOR_CYCLE(LED_color)];
+	uint16_t moves;
 
-	return (LED_SEQUENCE)_BestNextMove_Wrapper(map_friend, map_enmy, PLAYER_TYPE_FRIEND);
-}
+	moves = MoveTable::read(map_friend, map_enmy);
 
-MATRIX_3X3_ELEMENT LED_SQUARE::_BestNextMove_Wrapper(T_MATRIX_3X3 MatrixMap_Friend, T_MATRIX_3X3 MatrixMap_Enmy, PLAYER_TYPE WhoseTurn)
-{
-	if (_minmax_popcount(MatrixMap_Friend.d16 | MatrixMap_Enmy.d16) == LED_SEQ_TOTAL)  //matrix full
+	if (moves == MOVE_TABLE_INVALID)
 	{
-		return MATRIX_3X3_ELEMENT_TOTAL;
+		return BestNextMove(LED_color);
 	}
 
-	if (_minmax_popcount(MatrixMap_Friend.d16 | MatrixMap_Enmy.d16) == 0)
-	{
-		return random(LED_SEQ_TOTAL);
-	}
-
-	T_MATRIX_3X3 MatrixMap;
-	MATRIX_3X3_ELEMENT index, NextMove = MATRIX_3X3_ELEMENT_TOTAL;
-	int16_t ScoreMinMax;
-    
-	int16_t ScoreAlpha = INT16_MIN;
-	int16_t ScoreBeta = INT16_MAX;
-	
-	if (WhoseTurn == PLAYER_TYPE_FRIEND)
-	{
-		ScoreMinMax = INT16_MIN;
+	return (LED_SEQUENCE)minmax_engine.pick(moves);  //matrix full if no move
+}
 
-        SimpleQueue queue(sizeof(MATRIX_3X3_ELEMENT), MATRIX_3X3_ELEMENT_TOTAL);
+LED_SEQUENCE LED_SQUARE::BestNextMove_Retro(LED_COLOR LED_color)
+{
+	T_MATRIX_3X3 map_friend = MatrixBitmap[LED_color];
+	T_MATRIX_3X3 map_enmy = MatrixBitmap[COLOR_CYCLE(LED_color)];
+	uint16_t moves;
 
-		for (index = MATRIX_3X3_M11; index < LED_SEQ_TOTAL; index = index + 1)
-		{
-		    MatrixMap = (WhoseTurn == PLAYER_TYPE_FRIEND) ? MatrixMap_Friend : MatrixMap_Enmy;
-			if (!(MatrixMap.d16 & bit(index)) && !(MatrixMap_Enmy.d16 & bit(index)))
-			{
-				int score;
-				
-				MatrixMap.d16 |= bit(index);
-				score = _minmax(MatrixMap, MatrixMap_Enmy, ScoreAlpha, ScoreBeta, PLAYER_TYPE_ENMY);
+	moves = RetroTable::read(map_friend, map_enmy);
 
-				if (score > ScoreMinMax)
-				{
-					ScoreMinMax = score;
+	if (moves == RETRO_TABLE_INVALID)
+	{
+		return BestNextMove(LED_color);
+	}
 
-					queue.flush();
-					queue.push(&index);				
-				}
-				else if (score == ScoreMinMax)
-				{
-					queue.push(&index);
-				}
-			}
-		}
+	return (LED_SEQUENCE)minmax_engine.pick(moves);  //game over if no move
+}
 
-		int32_t NextMoveTotalNum;
-		int32_t NextMoveChoose;
-		
-		NextMoveTotalNum = queue.available();
+void LED_SQUARE::ponderStart(LED_COLOR LED_color)
+{
+	ponder_color = LED_color;
 
-		NextMoveChoose = (int32_t)random(NextMoveTotalNum);
+	minmax_engine.ponderStart(MatrixBitmap[LED_color], MatrixBitmap[COLOR_CYCLE(LED_color)], get_PositionHash(LED_color));
+}
 
-		queue.peekIndex(&NextMove, NextMoveChoose);
-	}
-	else if (WhoseTurn == PLAYER_TYPE_ENMY)
+void LED_SQUARE::ponderRoutine(uint32_t slice_us)
+{
+	if (ponder_color == LED_COLOR_TOTAL)
 	{
-		ScoreMinMax = INT16_MAX;
-		for (index = MATRIX_3X3_M11; index < LED_SEQ_TOTAL; index = index + 1)
-		{
-		    MatrixMap = (WhoseTurn == PLAYER_TYPE_FRIEND) ? MatrixMap_Friend : MatrixMap_Enmy;
-			if (!(MatrixMap.d16 & bit(index)) && !(MatrixMap_Friend.d16 & bit(index)))
-			{
-				int score;
-				
-				MatrixMap.d16 |= bit(index);
-				score = _minmax(MatrixMap_Friend, MatrixMap, ScoreAlpha, ScoreBeta, PLAYER_TYPE_FRIEND);
-				if (score < ScoreMinMax)
-				{
-					ScoreMinMax = score;
-					NextMove = index;
-				}				
-			}
-		}	
+		return;
 	}
 
-	return NextMove;
+	minmax_engine.ponderRoutine(MatrixBitmap[ponder_color], MatrixBitmap[COLOR_CYCLE(ponder_color)], slice_us);
 }
 
-int16_t LED_SQUARE::_minmax(T_MATRIX_3X3 MatrixMap_Friend, T_MATRIX_3X3 MatrixMap_Enmy, int16_t alpha_score, int16_t beta_score, PLAYER_TYPE WhoseTurn)
+void LED_SQUARE::ponderStop(void)
 {
-	T_MATRIX_3X3 MatrixMap_tmp;
+	ponder_color = LED_COLOR_TOTAL;
 
-	int16_t ScoreMinMax;
+	minmax_engine.ponderStop();
+}
 
-	ScoreMinMax = _minmax_cal_score(MatrixMap_Friend, MatrixMap_Enmy);
+void LED_SQUARE::set_PonderHint(LED_SEQUENCE LED_seq)
+{
+	minmax_engine.set_PonderHint((MATRIX_3X3_ELEMENT)LED_seq);
+}
 
-	if (ScoreMinMax || _minmax_popcount(MatrixMap_Friend.d16 | MatrixMap_Enmy.d16) == LED_SEQ_TOTAL)
-	{
-		//someone win or tie
-		return ScoreMinMax;
-	}
-	
-	T_MATRIX_3X3 MatrixMap;
-	
-	MATRIX_3X3_ELEMENT index;
+void LED_SQUARE::set_MoveOrder(MINMAX_MOVE_ORDER order)
+{
+	minmax_engine.set_MoveOrder(order);
+}
 
-	if (WhoseTurn == PLAYER_TYPE_FRIEND)
-	{
-		ScoreMinMax = INT16_MIN;
-		
-		for (index = MATRIX_3X3_M11; index < LED_SEQ_TOTAL; index = index + 1)
-		{
-			MatrixMap = (WhoseTurn == PLAYER_TYPE_FRIEND) ? MatrixMap_Friend : MatrixMap_Enmy;
-			if (!(MatrixMap.d16 & bit(index)) && !(MatrixMap_Enmy.d16 & bit(index)))
-			{
-				int score;
-				
-				MatrixMap.d16 |= bit(index);
-				score = _minmax(MatrixMap, MatrixMap_Enmy, alpha_score, beta_score, PLAYER_TYPE_ENMY);
-				if (score > ScoreMinMax)
-				{
-					ScoreMinMax = score;
-				}
+void LED_SQUARE::get_SearchStats(T_MINMAX_SEARCH_STATS *stats)
+{
+	minmax_engine.get_SearchStats(stats);
+}
 
-				if (score > alpha_score)
-				{
-					alpha_score = score;
-				}
+void LED_SQUARE::reset_SearchStats(void)
+{
+	minmax_engine.reset_SearchStats();
+}
 
-				if (beta_score <= alpha_score)
-				{
-					break;
-				}
-			}
-		}
-	}
-	else if (WhoseTurn == PLAYER_TYPE_ENMY)
-	{
-		ScoreMinMax = INT16_MAX;
-		
-		for (index = MATRIX_3X3_M11; index < LED_SEQ_TOTAL; index = index + 1)
-		{
-			MatrixMap = (WhoseTurn == PLAYER_TYPE_FRIEND) ? MatrixMap_Friend : MatrixMap_Enmy;
-			if (!(MatrixMap.d16 & bit(index)) && !(MatrixMap_Friend.d16 & bit((index))))
-			{
-				int score;
-				
-				MatrixMap.d16 |= bit((index));
-				score = _minmax(MatrixMap_Friend, MatrixMap, alpha_score, beta_score, PLAYER_TYPE_FRIEND);
-				if (score < ScoreMinMax)
-				{
-					ScoreMinMax = score;
-				}
+void LED_SQUARE::get_CacheStats(T_MINMAX_CACHE_STATS *stats)
+{
+	minmax_engine.get_CacheStats(stats);
+}
 
-				if (score < beta_score)
-				{
-					beta_score = score;
-				}
+void LED_SQUARE::reset_CacheStats(void)
+{
+	minmax_engine.reset_CacheStats();
+}
 
-				if (beta_score <= alpha_score)
-				{
-					break;
-				}				
-			}
-		}	
-	}
+#if MINMAX_MOVE_STATS
+void LED_SQUARE::get_MoveStats(T_MINMAX_MOVE_STATS *stats)
+{
+	minmax_engine.get_MoveStats(stats);
+}
+#endif
 
-	return ScoreMinMax;
+uint16_t LED_SQUARE::get_SearchStackSize(void)
+{
+	return MinmaxEngine::get_SearchStackSize();
+}
+
+MinmaxEngine *LED_SQUARE::get_Engine(void)
+{
+	return &minmax_engine;
+}
+
+uint16_t LED_SQUARE::get_PositionHash(LED_COLOR LED_color)
+{
+	return MatrixBitmapHash[LED_color] ^ MatrixHash::swap(MatrixBitmapHash[COLOR_CYCLE(LED_color)]);
 }
 
 void LED_SQUARE::_print_matrix_row(uint8_t friend_enable, uint8_t enmy_enable)
@@ -22,11 +22,12 @@
 #include "WProgram.h"
 #endif
 
+#include <EE33_Matrix.h>
+#include <EE33_Minmax.h>
+
 #define LED_VERSION_MAJOR  1
 #define LED_VERSION_MINOR  0
 
-#define MATRIX_3X3_LENGTH            3
-
 #define LED_BLINK_INTERVAL_MS        300
 
 #define SEQUENCE_INCREASE_CYCLE(seq)  (seq != LED_SEQ_MAX)? seq + 1 : LED_SEQ_MIN
@@ -34,9 +35,13 @@
 
 #define COLOR_CYCLE(color)            (color != LED_COLOR_MAX)? color + 1 : LED_COLOR_MIN
 
-#define INT16_MIN       (1 << 15)
-#define INT16_MAX       (0xFFFF >> 1)
+#ifndef INT16_MIN
+#define INT16_MIN       ((int16_t)(1 << 15))
+#endif
 
+#ifndef INT16_MAX
+#define INT16_MAX       (0xFFFF >> 1)
+#endif
 
 typedef enum LED_STATUS
 {
@@ -74,56 +79,6 @@ typedef enum LED_SEQUENCE
 	LED_SEQ_MAX = LED_9,
 };
 
-typedef union
-{
-  uint16_t d16;
-  struct
-  {
-	  uint16_t m11 : 1; uint16_t m12 : 1; uint16_t m13 : 1;
-	  uint16_t m21 : 1; uint16_t m22 : 1; uint16_t m23 : 1;
-	  uint16_t m31 : 1; uint16_t m32 : 1; uint16_t m33 : 1;
-	  uint16_t rsv : 7;
-  };
-} T_MATRIX_3X3;
-
-typedef enum PLAYER_TYPE
-{
-	PLAYER_TYPE_FRIEND,
-    PLAYER_TYPE_ENMY,
-    
-	PLAYER_TYPE_MIN = PLAYER_TYPE_FRIEND,
-	PLAYER_TYPE_MAX = PLAYER_TYPE_ENMY,	
-};
-
-typedef enum MATRIX_3X3_ELEMENT
-{
-	MATRIX_3X3_M11 = 0,
-	MATRIX_3X3_M12 = 1,
-	MATRIX_3X3_M13 = 2,
-	MATRIX_3X3_M21 = 3,
-	MATRIX_3X3_M22 = 4,
-	MATRIX_3X3_M23 = 5,
-	MATRIX_3X3_M31 = 6,
-	MATRIX_3X3_M32 = 7,
-	MATRIX_3X3_M33 = 8,
-	
-	MATRIX_3X3_ELEMENT_TOTAL,
-};
-
-typedef enum LINE_SEQUENCE
-{
-	LINE_1 = 0,
-	LINE_2 = 1,
-	LINE_3 = 2,
-	LINE_4 = 3,
-	LINE_5 = 4,
-	LINE_6 = 5,
-	LINE_7 = 6,
-	LINE_8 = 7,
-	
-	LINE_SEQ_TOTAL,
-};
-
 typedef struct
 {
   LED_STATUS status;
@@ -255,6 +210,146 @@ public:
 	*/
 	LED_SEQUENCE BestNextMove(LED_COLOR LED_color);
 
+/**
+	* @brief according to current status, calculate the next step in limited time
+	* @param LED_color color of now player
+	* @param budget_us time limit in microseconds, 0 means no limit
+	* @return next position
+	* @note  search goes one ply deeper each round, and stops when budget runs out.
+	*        Best move of the last finished round is taken, positions beyond the
+	*        searched depth are guessed by open lines. The first round is always
+	*        finished, so it may take a little longer than a tiny budget.
+	*/
+	LED_SEQUENCE BestNextMove(LED_COLOR LED_color, uint32_t budget_us);
+
+/**
+	* @brief score every empty position in one search
+	* @param LED_color color of now player
+	* @param scores minmax score of putting LED_color on each position, in view of
+	*        LED_color, MINMAX_SCORE_NONE for occupied position
+	* @return mask of best moves(bit n is LED_SEQUENCE n), same choices as BestNextMove
+	* @note  every move is searched with full window, so the scores are exact, not only
+	*        the best one. Symmetric moves share one search, and the cache carries
+	*        positions from one move to the next. Pondering is stopped, as by
+	*        BestNextMove.
+	*/
+	uint16_t ScoreAllMoves(LED_COLOR LED_color, int8_t scores[MATRIX_3X3_ELEMENT_TOTAL]);
+
+/**
+	* @brief according to current status, look up the next step in flash move table
+	* @param LED_color color of now player
+	* @return next position
+	* @note  same result as BestNextMove without any search, but about 3.4KB flash
+	*        is taken by the table. Position not in table falls back to BestNextMove.
+	*/
+	LED_SEQUENCE BestNextMove_Lookup(LED_COLOR LED_color);
+
+/**
+	* @brief according to current status, take the next step from flash retrograde database
+	* @param LED_color color of now player
+	* @return next position
+	* @note  wins in the fewest plies and loses in the most, unlike BestNextMove which
+	*        takes any move of the same score. About 9.6KB flash is taken by the table.
+	*        Position not in database falls back to BestNextMove.
+	*/
+	LED_SEQUENCE BestNextMove_Retro(LED_COLOR LED_color);
+
+/**
+	* @brief start to ponder, search the replies to every move of the other one
+	* @param LED_color color of computer, the other color is the next one to move
+	* @note  pondered replies are the same as BestNextMove, it reads them instead of
+	*        searching again if the other one made a single move since ponderStart.
+	*/
+	void ponderStart(LED_COLOR LED_color);
+
+/**
+	* @brief drive pondering work a slice of time, it needs to be execute in loop
+	* @param slice_us time of the slice in microseconds
+	* @par   sample code
+	* @code
+    *       loop 
+    *       {
+    *           blinkRoutine();     
+    *           ponderRoutine(300);     
+    *       }
+    *    
+	* @endcode
+	* @note  pondering stops by itself when the position is changed
+	*/
+	void ponderRoutine(uint32_t slice_us);
+
+/**
+	* @brief stop pondering, pondered replies are dropped
+	*/
+	void ponderStop(void);
+
+/**
+	* @brief tell which move the other one is likely to make, it is pondered next
+	* @param LED_seq for example the blinking LED of the other one
+	*/
+	void set_PonderHint(LED_SEQUENCE LED_seq);
+
+/**
+	* @brief select the order of moves tried in search, it changes search speed only
+	* @param order
+	* @arg   MINMAX_ORDER_INDEX
+	* @arg   MINMAX_ORDER_HEURISTIC(default)
+	*/
+	void set_MoveOrder(MINMAX_MOVE_ORDER order);
+
+/**
+	* @brief get node and cutoff counter of minmax search
+	* @param *stats
+	* @note  counters keep adding up between BestNextMove calls, until reset_SearchStats
+	*/
+	void get_SearchStats(T_MINMAX_SEARCH_STATS *stats);
+
+/**
+	* @brief clear node and cutoff counter of minmax search
+	*/
+	void reset_SearchStats(void);
+
+/**
+	* @brief get hit, miss and replace counter of minmax cache
+	* @param *stats
+	* @note  counters keep adding up between BestNextMove calls, until reset_CacheStats
+	*/
+	void get_CacheStats(T_MINMAX_CACHE_STATS *stats);
+
+/**
+	* @brief clear hit, miss and replace counter of minmax cache
+	*/
+	void reset_CacheStats(void);
+
+#if MINMAX_MOVE_STATS
+/**
+	* @brief get the cost of the last BestNextMove or ScoreAllMoves
+	* @param *stats nodes, cutoffs, depth, cache hits and micros() spent
+	* @note  only with MINMAX_MOVE_STATS set to 1. BestNextMove_Lookup and
+	*        BestNextMove_Retro do not search and leave it as it was.
+	*/
+	void get_MoveStats(T_MINMAX_MOVE_STATS *stats);
+#endif
+
+/**
+	* @brief get hash of current position, it is kept up to date by set_LEDStatus
+	* @param LED_color color of friend
+	* @return hash of friend and enmy pieces, see MatrixHash
+	*/
+	uint16_t get_PositionHash(LED_COLOR LED_color);
+
+/**
+	* @brief get SRAM bytes of minmax search stack
+	* @return bytes, the worst case of any search, not more than MINMAX_STACK_BUDGET
+	*/
+	uint16_t get_SearchStackSize(void);
+
+/**
+	* @brief get the search engine, for example to tune it or read more counters
+	* @return engine searching for this LED square
+	*/
+	MinmaxEngine *get_Engine(void);
+
 /**
 	* @brief print LED distribution(for debug) 	
 	*/
@@ -286,41 +381,6 @@ private:
 	*/
 	LED_SEQUENCE _find_IdleLed(LED_SEQUENCE LED_now, bool is_next);
 
-/**
-	* @brief  count bit 1
-	* @param  n
-	* @return total bit 1 in number 	
-	*/
-	uint8_t _minmax_popcount(uint32_t n);
-	
-/**
-	* @brief  calculate minmax score
-	* @param  MatrixMap_Friend
-	* @param  MatrixMap_Enmy	
-	* @return minmax score 	
-	*/	
-	int16_t _minmax_cal_score(T_MATRIX_3X3 MatrixMap_Friend, T_MATRIX_3X3 MatrixMap_Enmy);
-
-/**
-	* @brief according to current friend and enmy status, calculate the next step  
-	* @param MatrixMap_Friend map of friend
-	* @param MatrixMap_Enmy map of enmy
-	* @param WhoseTurn next step of friend or enmy		 	
-	* @return next position	
-	*/
-	MATRIX_3X3_ELEMENT _BestNextMove_Wrapper(T_MATRIX_3X3 MatrixMap_Friend, T_MATRIX_3X3 MatrixMap_Enmy, PLAYER_TYPE WhoseTurn);
-
-/**
-	* @brief according to current friend and enmy status, calculate the score  
-	* @param MatrixMap_Friend map of friend
-	* @param MatrixMap_Enmy map of enmy
-	* @param alpha_score
-	* @param beta_score
-	* @param WhoseTurn 			 	
-	* @return score	of current state in WhoseTurn
-	*/
-	int16_t _minmax(T_MATRIX_3X3 MatrixMap_Friend, T_MATRIX_3X3 MatrixMap_Enmy, int16_t alpha_score, int16_t beta_score, PLAYER_TYPE WhoseTurn);
-
     void _print_matrix(T_MATRIX_3X3 MatrixMap_Friend, T_MATRIX_3X3 MatrixMap_Enmy);
 
 	void _print_matrix_row(uint8_t friend_enable, uint8_t enmy_enable);
@@ -334,8 +394,20 @@ private:
 	/** LED bitmap */
 	T_MATRIX_3X3 MatrixBitmap[LED_COLOR_TOTAL];
 
+	/** hash of LED bitmap with friend keys, updated by set_LEDStatus */
+	uint16_t MatrixBitmapHash[LED_COLOR_TOTAL];
+
+	/** blinking LEDs, not idle though not in LED bitmap, updated by set_LEDStatus */
+	uint16_t BlinkBitmap[LED_COLOR_TOTAL];
+
 	/** blinking LED millis accumulation */
     unsigned long LED_blink_millis_accumulation;
+
+	/** search engine, LED bitmaps are passed to it */
+	MinmaxEngine minmax_engine;
+
+	/** LED_COLOR of computer while pondering, LED_COLOR_TOTAL means stopped */
+	uint8_t ponder_color;
 };
 
 #endif  //EE33_LED_H
@@ -0,0 +1,209 @@
+/**
+  * @file      EE33_Matrix.cpp
+  * @version   v1.0
+  * @author    3lectron3ats <3lectron3ats@gmail.com>
+  * @date      2026.10.16
+  * @brief     Bitmap of 3x3 matrix, shared by LED and search.
+  * @copyright GPL v3.0
+  * *************************************************************************************
+  * @attention
+  * <h2><center>&copy; COPYRIGHT 2023 3lectron3ats </center></h2>
+  * *************************************************************************************
+  */
+
+#include <EE33_Tic_Tac_Toe.h>
+#include <EE33_Matrix.h>
+
+/** elements of every line, same as StraightLine_3X3 */
+const uint16_t line_mask_3X3[LINE_SEQ_TOTAL] PROGMEM =
+{
+	0x007, 0x038, 0x1C0,  //rows
+	0x049, 0x092, 0x124,  //columns
+	0x111, 0x054,         //diagonals
+};
+
+/** random hash keys of pieces, enmy row is friend row rotated by 5 bits */
+const uint16_t matrix_hash_key[PLAYER_TYPE_MAX + 1][MATRIX_3X3_ELEMENT_TOTAL] PROGMEM =
+{
+	[PLAYER_TYPE_FRIEND] = {0x10C, 0x029, 0x1F0, 0x17A, 0x0E0, 0x2F2, 0x3B9, 0x04C, 0x070},
+	[PLAYER_TYPE_ENMY]   = {0x188, 0x121, 0x20F, 0x34B, 0x007, 0x257, 0x33D, 0x182, 0x203},
+};
+
+/** bit(element), the pad is no element */
+const uint16_t matrix_bit_mask[MATRIX_3X3_ELEMENT_TOTAL + 1] PROGMEM =
+{
+	0x001, 0x002, 0x004, 0x008, 0x010, 0x020, 0x040, 0x080, 0x100, 0x000,
+};
+
+/** multiplier putting a different number in the top 4 bits for every one bit map, 0 for none */
+#define MATRIX_BIT_MAGIC  0x1350
+
+/** element of every one bit map, indexed by top 4 bits of map * MATRIX_BIT_MAGIC */
+const uint8_t matrix_bit_element[16] PROGMEM =
+{
+	MATRIX_3X3_ELEMENT_TOTAL, MATRIX_3X3_M11, MATRIX_3X3_M12, MATRIX_3X3_M22,
+	MATRIX_3X3_M13, MATRIX_3X3_M33, MATRIX_3X3_M23, MATRIX_3X3_ELEMENT_TOTAL,
+	MATRIX_3X3_ELEMENT_TOTAL, MATRIX_3X3_M21, MATRIX_3X3_M32, MATRIX_3X3_ELEMENT_TOTAL,
+	MATRIX_3X3_ELEMENT_TOTAL, MATRIX_3X3_M31, MATRIX_3X3_ELEMENT_TOTAL, MATRIX_3X3_ELEMENT_TOTAL,
+};
+
+/** bit 1 in every nibble */
+const uint8_t matrix_bit_count[16] PROGMEM =
+{
+	0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+};
+
+/** bingo lines of every 9-bit matrix, bit n is LINE_SEQUENCE n(StraightLine_3X3[n]) */
+const uint8_t bingo_line_3X3[1 << MATRIX_3X3_ELEMENT_TOTAL] PROGMEM =
+{
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,  //0x000
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,  //0x010
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,  //0x020
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03,  //0x030
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x09,  //0x040
+	0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x81, 0x00, 0x08, 0x00, 0x08, 0x80, 0x88, 0x80, 0x89,  //0x050
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x09,  //0x060
+	0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x81, 0x02, 0x0A, 0x02, 0x0A, 0x82, 0x8A, 0x82, 0x8B,  //0x070
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,  //0x080
+	0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x10, 0x11, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x10, 0x11,  //0x090
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,  //0x0A0
+	0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x10, 0x11, 0x02, 0x02, 0x12, 0x12, 0x02, 0x02, 0x12, 0x13,  //0x0B0
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x09,  //0x0C0
+	0x00, 0x00, 0x10, 0x10, 0x80, 0x80, 0x90, 0x91, 0x00, 0x08, 0x10, 0x18, 0x80, 0x88, 0x90, 0x99,  //0x0D0
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x09,  //0x0E0
+	0x00, 0x00, 0x10, 0x10, 0x80, 0x80, 0x90, 0x91, 0x02, 0x0A, 0x12, 0x1A, 0x82, 0x8A, 0x92, 0x9B,  //0x0F0
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,  //0x100
+	0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x41, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x41,  //0x110
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x21, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x21,  //0x120
+	0x00, 0x40, 0x00, 0x40, 0x20, 0x60, 0x20, 0x61, 0x02, 0x42, 0x02, 0x42, 0x22, 0x62, 0x22, 0x63,  //0x130
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x09,  //0x140
+	0x00, 0x40, 0x00, 0x40, 0x80, 0xC0, 0x80, 0xC1, 0x00, 0x48, 0x00, 0x48, 0x80, 0xC8, 0x80, 0xC9,  //0x150
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x21, 0x00, 0x08, 0x00, 0x08, 0x20, 0x28, 0x20, 0x29,  //0x160
+	0x00, 0x40, 0x00, 0x40, 0xA0, 0xE0, 0xA0, 0xE1, 0x02, 0x4A, 0x02, 0x4A, 0xA2, 0xEA, 0xA2, 0xEB,  //0x170
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,  //0x180
+	0x00, 0x40, 0x10, 0x50, 0x00, 0x40, 0x10, 0x51, 0x00, 0x40, 0x10, 0x50, 0x00, 0x40, 0x10, 0x51,  //0x190
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x21, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x21,  //0x1A0
+	0x00, 0x40, 0x10, 0x50, 0x20, 0x60, 0x30, 0x71, 0x02, 0x42, 0x12, 0x52, 0x22, 0x62, 0x32, 0x73,  //0x1B0
+	0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x04, 0x0C, 0x04, 0x0C, 0x04, 0x0C, 0x04, 0x0D,  //0x1C0
+	0x04, 0x44, 0x14, 0x54, 0x84, 0xC4, 0x94, 0xD5, 0x04, 0x4C, 0x14, 0x5C, 0x84, 0xCC, 0x94, 0xDD,  //0x1D0
+	0x04, 0x04, 0x04, 0x04, 0x24, 0x24, 0x24, 0x25, 0x04, 0x0C, 0x04, 0x0C, 0x24, 0x2C, 0x24, 0x2D,  //0x1E0
+	0x04, 0x44, 0x14, 0x54, 0xA4, 0xE4, 0xB4, 0xF5, 0x06, 0x4E, 0x16, 0x5E, 0xA6, 0xEE, 0xB6, 0xFF,  //0x1F0
+};
+
+uint8_t MatrixLine::get_BingoLine(T_MATRIX_3X3 MatrixMap)
+{
+	return pgm_read_byte(&bingo_line_3X3[MatrixMap.d16 & MATRIX_3X3_MASK]);
+}
+
+bool MatrixLine::Is_Bingo(T_MATRIX_3X3 MatrixMap)
+{
+	return get_BingoLine(MatrixMap) != 0;
+}
+
+uint8_t MatrixLine::get_OpenLine(T_MATRIX_3X3 MatrixMap_Own, T_MATRIX_3X3 MatrixMap_Other)
+{
+	uint8_t result = 0;
+
+	for (uint8_t line = LINE_1; line < LINE_SEQ_TOTAL; line++)
+	{
+		uint16_t mask = pgm_read_word(&line_mask_3X3[line]);
+
+		if ((MatrixMap_Own.d16 & mask) && !(MatrixMap_Other.d16 & mask))
+		{
+			result |= bit(line);
+		}
+	}
+
+	return result;
+}
+
+uint16_t MatrixLine::get_LineMask(LINE_SEQUENCE line)
+{
+	return pgm_read_word(&line_mask_3X3[line]);
+}
+
+uint16_t MatrixHash::key(PLAYER_TYPE player, MATRIX_3X3_ELEMENT element)
+{
+	return pgm_read_word(&matrix_hash_key[player][element]);
+}
+
+uint16_t MatrixHash::swap(uint16_t hash)
+{
+	//rotate 10 bits by half, doing it twice gets the hash back
+	return ((hash << 5) | (hash >> 5)) & MATRIX_HASH_MASK;
+}
+
+uint16_t MatrixHash::hash(T_MATRIX_3X3 MatrixMap_Friend, T_MATRIX_3X3 MatrixMap_Enmy, PLAYER_TYPE WhoseTurn)
+{
+	uint16_t result = (WhoseTurn == PLAYER_TYPE_ENMY) ? MATRIX_HASH_TURN : 0;
+	MATRIX_3X3_ELEMENT element;
+
+	for (element = MATRIX_3X3_M11; element < MATRIX_3X3_ELEMENT_TOTAL; element = element + 1)
+	{
+		result ^= (MatrixMap_Friend.d16 & MatrixBit::mask(element)) ? key(PLAYER_TYPE_FRIEND, element) : 0;
+		result ^= (MatrixMap_Enmy.d16 & MatrixBit::mask(element)) ? key(PLAYER_TYPE_ENMY, element) : 0;
+	}
+
+	return result;
+}
+
+uint16_t MatrixBit::mask(MATRIX_3X3_ELEMENT element)
+{
+	return pgm_read_word(&matrix_bit_mask[element]);
+}
+
+uint8_t MatrixBit::count(uint16_t map)
+{
+#if defined(__POPCNT__)
+	return __builtin_popcount(map);  //one instruction
+#else
+	//__builtin_popcount is a call into libgcc without popcnt instruction(AVR included), 4 table reads are cheaper
+	uint8_t low = (uint8_t)map, high = (uint8_t)(map >> 8);
+
+	return pgm_read_byte(&matrix_bit_count[low & 0x0F]) + pgm_read_byte(&matrix_bit_count[low >> 4])
+	     + pgm_read_byte(&matrix_bit_count[high & 0x0F]) + pgm_read_byte(&matrix_bit_count[high >> 4]);
+#endif
+}
+
+bool MatrixBit::Is_Full(T_MATRIX_3X3 MatrixMap_Friend, T_MATRIX_3X3 MatrixMap_Enmy)
+{
+	return (MatrixMap_Friend.d16 | MatrixMap_Enmy.d16) == MATRIX_3X3_MASK;
+}
+
+uint16_t MatrixBit::empty(T_MATRIX_3X3 MatrixMap_Friend, T_MATRIX_3X3 MatrixMap_Enmy)
+{
+	return ~(MatrixMap_Friend.d16 | MatrixMap_Enmy.d16) & MATRIX_3X3_MASK;
+}
+
+MATRIX_3X3_ELEMENT MatrixBit::lowest(uint16_t map)
+{
+	//map & -map keeps the lowest bit only
+	return (MATRIX_3X3_ELEMENT)pgm_read_byte(&matrix_bit_element[(uint16_t)((map & -map) * MATRIX_BIT_MAGIC) >> 12]);
+}
+
+MATRIX_3X3_ELEMENT MatrixBit::highest(uint16_t map)
+{
+	//fill every bit below the highest, then keep the highest only
+	map |= map >> 1;
+	map |= map >> 2;
+	map |= map >> 4;
+	map |= map >> 8;
+
+	return lowest(map ^ (map >> 1));
+}
+
+MATRIX_3X3_ELEMENT MatrixBit::pop(uint16_t *map)
+{
+	MATRIX_3X3_ELEMENT element = lowest(*map);
+
+	*map &= *map - 1;
+
+	return element;
+}
+
+
+/*
+ * @release note
+ * | v1.0 2026-10-16 - 3lectron3ats : Initial Release
+ * #
+*/
@@ -0,0 +1,210 @@
+/**
+  * @file      EE33_Matrix.h
+  * @version   v1.0
+  * @author    3lectron3ats <3lectron3ats@gmail.com>
+  * @date      2026.10.16
+  * @brief     Bitmap of 3x3 matrix, shared by LED and search.
+  * @copyright GPL v3.0
+  * *************************************************************************************
+  * @attention
+  * <h2><center>&copy; COPYRIGHT 2023 3lectron3ats </center></h2>
+  * *************************************************************************************
+  */
+
+
+#ifndef EE33_MATRIX_H
+#define EE33_MATRIX_H
+
+// Arduino versioning.
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "Arduino.h"	// for digitalRead, digitalWrite, etc
+#else
+#include "WProgram.h"
+#endif
+
+#define MATRIX_3X3_LENGTH            3
+#define MATRIX_3X3_MASK              0x1FF
+
+#define MATRIX_HASH_MASK             0x3FF  /*!< 10-bit hash, enough to spread 256 cache entries */
+#define MATRIX_HASH_TURN             0x3DC  /*!< hash key of enmy to move */
+
+typedef union
+{
+  uint16_t d16;
+  struct
+  {
+	  uint16_t m11 : 1; uint16_t m12 : 1; uint16_t m13 : 1;
+	  uint16_t m21 : 1; uint16_t m22 : 1; uint16_t m23 : 1;
+	  uint16_t m31 : 1; uint16_t m32 : 1; uint16_t m33 : 1;
+	  uint16_t rsv : 7;
+  };
+} T_MATRIX_3X3;
+
+typedef enum PLAYER_TYPE
+{
+	PLAYER_TYPE_FRIEND,
+    PLAYER_TYPE_ENMY,
+    
+	PLAYER_TYPE_MIN = PLAYER_TYPE_FRIEND,
+	PLAYER_TYPE_MAX = PLAYER_TYPE_ENMY,	
+};
+
+typedef enum MATRIX_3X3_ELEMENT
+{
+	MATRIX_3X3_M11 = 0,
+	MATRIX_3X3_M12 = 1,
+	MATRIX_3X3_M13 = 2,
+	MATRIX_3X3_M21 = 3,
+	MATRIX_3X3_M22 = 4,
+	MATRIX_3X3_M23 = 5,
+	MATRIX_3X3_M31 = 6,
+	MATRIX_3X3_M32 = 7,
+	MATRIX_3X3_M33 = 8,
+	
+	MATRIX_3X3_ELEMENT_TOTAL,
+};
+
+typedef enum LINE_SEQUENCE
+{
+	LINE_1 = 0,
+	LINE_2 = 1,
+	LINE_3 = 2,
+	LINE_4 = 3,
+	LINE_5 = 4,
+	LINE_6 = 5,
+	LINE_7 = 6,
+	LINE_8 = 7,
+	
+	LINE_SEQ_TOTAL,
+};
+
+class MatrixLine
+{
+public:
+
+/**
+	* @brief  find all the bingo lines(3 in a line) of matrix by one flash lookup
+	* @param  MatrixMap
+	* @return bit n set means LINE_SEQUENCE n is bingo, 0 means no bingo line
+	*/
+	static uint8_t get_BingoLine(T_MATRIX_3X3 MatrixMap);
+
+/**
+	* @brief  matrix has bingo line or not
+	* @param  MatrixMap
+	* @retval true at least one line is bingo
+	* @retval false no bingo line
+	*/
+	static bool Is_Bingo(T_MATRIX_3X3 MatrixMap);
+
+/**
+	* @brief  find the lines which still can be bingo for one side
+	* @param  MatrixMap_Own map of the side
+	* @param  MatrixMap_Other map of the other side
+	* @return bit n set means LINE_SEQUENCE n has own element and no other element
+	*/
+	static uint8_t get_OpenLine(T_MATRIX_3X3 MatrixMap_Own, T_MATRIX_3X3 MatrixMap_Other);
+
+/**
+	* @brief  elements of a line
+	* @param  line
+	* @return 9-bit mask, same as StraightLine_3X3[line]
+	*/
+	static uint16_t get_LineMask(LINE_SEQUENCE line);
+};
+
+class MatrixHash
+{
+public:
+
+/**
+	* @brief  hash key of a piece, position hash is XOR of the keys of all pieces
+	* @param  player
+	* @param  element
+	* @return key, enmy key is swap() of friend key
+	*/
+	static uint16_t key(PLAYER_TYPE player, MATRIX_3X3_ELEMENT element);
+
+/**
+	* @brief  hash of the same pieces owned by the other player
+	* @param  hash
+	* @return hash with friend and enmy keys exchanged
+	*/
+	static uint16_t swap(uint16_t hash);
+
+/**
+	* @brief  calculate hash of position from scratch
+	* @param  MatrixMap_Friend map of friend
+	* @param  MatrixMap_Enmy map of enmy
+	* @param  WhoseTurn
+	* @return hash, MATRIX_HASH_TURN is in it if enmy to move
+	*/
+	static uint16_t hash(T_MATRIX_3X3 MatrixMap_Friend, T_MATRIX_3X3 MatrixMap_Enmy, PLAYER_TYPE WhoseTurn);
+};
+
+class MatrixBit
+{
+public:
+
+/**
+	* @brief  mask of one element, bit(element) without shifting on AVR
+	* @param  element MATRIX_3X3_ELEMENT_TOTAL gets 0
+	* @return one bit mask from flash
+	*/
+	static uint16_t mask(MATRIX_3X3_ELEMENT element);
+
+/**
+	* @brief  count bit 1
+	* @param  map
+	* @return bit 1 in map, by nibble table in flash, __builtin_popcount if the CPU has popcnt
+	*/
+	static uint8_t count(uint16_t map);
+
+/**
+	* @brief  all elements are taken or not
+	* @param  MatrixMap_Friend
+	* @param  MatrixMap_Enmy
+	*/
+	static bool Is_Full(T_MATRIX_3X3 MatrixMap_Friend, T_MATRIX_3X3 MatrixMap_Enmy);
+
+/**
+	* @brief  empty elements of a position, to be walked by pop()
+	* @param  MatrixMap_Friend
+	* @param  MatrixMap_Enmy
+	* @return 9-bit mask of elements taken by nobody
+	*/
+	static uint16_t empty(T_MATRIX_3X3 MatrixMap_Friend, T_MATRIX_3X3 MatrixMap_Enmy);
+
+/**
+	* @brief  smallest element of a map by one flash lookup
+	* @param  map
+	* @return element, MATRIX_3X3_ELEMENT_TOTAL if map is 0
+	* @note   trailing zeros of a 9-bit map
+	*/
+	static MATRIX_3X3_ELEMENT lowest(uint16_t map);
+
+/**
+	* @brief  biggest element of a map
+	* @param  map
+	* @return element, MATRIX_3X3_ELEMENT_TOTAL if map is 0
+	*/
+	static MATRIX_3X3_ELEMENT highest(uint16_t map);
+
+/**
+	* @brief  take the smallest element out of a map
+	* @param  *map
+	* @return element, MATRIX_3X3_ELEMENT_TOTAL if *map is 0
+	* @note   for (moves = empty(...); moves; ) { element = pop(&moves); ... } walks
+	*         the empty elements without testing each of the 9
+	*/
+	static MATRIX_3X3_ELEMENT pop(uint16_t *map);
+};
+
+#endif  //EE33_MATRIX_H
+
+
+/*
+ * @release note
+ * | v1.0 2026-10-16 - 3lectron3ats : Initial Release
+ * #
+*/
@@ -0,0 +1,516 @@
+/**
+  * @file      EE33_Mcts.h
+  * @version   v1.0
+  * @author    3lectron3ats <3lectron3ats@gmail.com>
+  * @date      2026.10.16
+  * @brief     Monte Carlo tree search on m,n,k board, nodes in a fixed arena.
+  * @copyright GPL v3.0
+  * *************************************************************************************
+  * @attention
+  * <h2><center>&copy; COPYRIGHT 2023 3lectron3ats </center></h2>
+  * *************************************************************************************
+  * @note
+  *   MctsBoard is a Board<M,N,K> which picks the next step by UCT instead of alpha-beta,
+  *   for boards too big to search to the end. Every iteration walks down the tree by
+  *   UCT, adds one node, plays randomly to the end of game and adds the result to the
+  *   nodes on the way. Move visited most at root is taken.
+  *   Tree nodes live in an array of NODES, it is part of the object and nothing is
+  *   allocated. When it is full, iterations go on with random playouts from the
+  *   leaves. One node takes 9 bytes on AVR, so NODES = 128 takes 1152 bytes of SRAM.
+  *   UCT is worked out in 8.8 fixed point with two flash tables, no float at all;
+  *   soft float log, sqrt and division cost hundreds of cycles each on AVR.
+  * @par    sample code
+  * @code
+  *       MctsBoard<4, 4, 4, 100> board;
+  *
+  *       board.set_Cell(MctsBoard<4, 4, 4, 100>::cell(1, 1), PLAYER_TYPE_ENMY);
+  *       next_step = board.BestNextMove(PLAYER_TYPE_FRIEND, 200000);
+  * @endcode
+  */
+
+
+#ifndef EE33_MCTS_H
+#define EE33_MCTS_H
+
+// Arduino versioning.
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "Arduino.h"	// for digitalRead, digitalWrite, etc
+#else
+#include "WProgram.h"
+#endif
+
+#include <EE33_Board.h>
+
+#define MCTS_VERSION_MAJOR  1
+#define MCTS_VERSION_MINOR  0
+
+/** no node, end of children list */
+#define MCTS_NODE_NONE             0xFFFF
+
+/** iterations of BestNextMove if neither iteration limit nor time budget is given */
+#define MCTS_ITERATION_DEFAULT     1000
+
+/** most iterations of one BestNextMove, a visit adds up to 2 to score, so score stays in 16 bits */
+#define MCTS_ITERATION_MAX         0x7FFF
+
+/** iterations between two checks of the time budget, must be power of 2 */
+#define MCTS_TIME_CHECK_ITERATIONS 16
+
+/** weight of exploration in UCT, square root of 2, mcts_explore is made with it */
+#define MCTS_EXPLORATION           1.414f
+
+/** MCTS_EXPLORATION * sqrt(ln(visit)) * 256, index is log2(visit) in quarters */
+static const uint16_t mcts_explore[64] PROGMEM =
+{
+	   0,    0,    0,    0,  301,  301,  379,  379,
+	 444,  473,  495,  514,  537,  561,  580,  596,
+	 615,  636,  653,  668,  685,  704,  720,  732,
+	 749,  766,  780,  792,  807,  823,  836,  847,
+	 861,  877,  889,  899,  913,  927,  939,  949,
+	 961,  975,  986,  995, 1007, 1020, 1031, 1040,
+	1051, 1064, 1074, 1083, 1094, 1106, 1115, 1124,
+	1134, 1146, 1155, 1164, 1174, 1185, 1194, 1202,
+};
+
+/** 4096 / sqrt(visit) for visit 1 ~ 64, bigger visits are divided by 4 until they fit */
+static const uint16_t mcts_inv_sqrt[65] PROGMEM =
+{
+	4096, 4096, 2896, 2365, 2048, 1832, 1672, 1548, 1448,
+	1365, 1295, 1235, 1182, 1136, 1095, 1058, 1024,  993,
+	 965,  940,  916,  894,  873,  854,  836,  819,  803,
+	 788,  774,  761,  748,  736,  724,  713,  702,  692,
+	 683,  673,  664,  656,  648,  640,  632,  625,  617,
+	 611,  604,  597,  591,  585,  579,  574,  568,  563,
+	 557,  552,  547,  543,  538,  533,  529,  524,  520,
+	 516,  512,
+};
+
+/** result of a game in view of one player, in half points */
+#define MCTS_RESULT_WIN            2
+#define MCTS_RESULT_DRAW           1
+#define MCTS_RESULT_LOSE           0
+
+template <uint8_t M, uint8_t N, uint8_t K, uint16_t NODES = 128>
+class MctsBoard : public Board<M, N, K, 1>
+{
+public:
+
+	typedef typename Board<M, N, K, 1>::T_BITMAP T_BITMAP;
+
+	static const uint8_t CELL_TOTAL = M * N;
+	static const uint16_t NODE_TOTAL = NODES;
+
+	static_assert(NODES >= 2 && NODES < MCTS_NODE_NONE, "arena must hold 2 ~ 65534 nodes");
+
+/**
+	* @brief  construction, board is empty, MCTS_ITERATION_DEFAULT iterations
+	*/
+	MctsBoard()
+	{
+		iteration_limit = MCTS_ITERATION_DEFAULT;
+		iteration_done = 0;
+		node_used = 0;
+		random_state = 0x2545F491;
+		reset_Playout();
+	}
+
+/**
+	* @brief  set the number of iterations of BestNextMove
+	* @param  iterations 0 means only time budget stops the search, not more than
+	*         MCTS_ITERATION_MAX, bigger ones are cut to it
+	*/
+	void set_Iterations(uint16_t iterations)
+	{
+		iteration_limit = (iterations > MCTS_ITERATION_MAX) ? MCTS_ITERATION_MAX : iterations;
+	}
+
+/**
+	* @brief  calculate the next step of player
+	* @param  player the one to move
+	* @param  budget_us time limit in microseconds, 0 means no limit
+	* @return cell, BOARD_CELL_NONE means board full
+	* @note   search stops at the iteration limit or when budget runs out, whichever
+	*         comes first. Without both, MCTS_ITERATION_DEFAULT iterations are done.
+	*         Never more than MCTS_ITERATION_MAX, even with a long budget. Position in
+	*         opening book(set_Book) takes a book move without search.
+	*/
+	uint8_t BestNextMove(PLAYER_TYPE player, uint32_t budget_us = 0)
+	{
+		T_BITMAP own = this->get_Map(player);
+		T_BITMAP other = this->get_Map((player == PLAYER_TYPE_FRIEND) ? PLAYER_TYPE_ENMY : PLAYER_TYPE_FRIEND);
+		T_BITMAP book = this->get_BookMoves(player);
+		uint32_t limit = (iteration_limit) ? iteration_limit : (budget_us) ? MCTS_ITERATION_MAX : MCTS_ITERATION_DEFAULT;
+		uint32_t start_us = micros(), iteration;
+		uint16_t best = MCTS_NODE_NONE, child;
+
+		if ((own | other) == _full())
+		{
+			return BOARD_CELL_NONE;
+		}
+
+		random_state ^= (uint32_t)random(0x7FFFFFFF);
+		random_state = (random_state) ? random_state : 1;
+
+		if (book)
+		{
+			iteration_done = 0;
+			node_used = 0;
+
+			return _random_cell(book);
+		}
+
+		node_used = 1;
+		arena[0].visit = 0;
+		arena[0].score = 0;
+		arena[0].child = MCTS_NODE_NONE;
+		arena[0].sibling = MCTS_NODE_NONE;
+		arena[0].move = BOARD_CELL_NONE;
+
+		//limit is not more than MCTS_ITERATION_MAX, score of any node is kept in 16 bits
+		for (iteration = 0; iteration < limit; iteration++)
+		{
+			if (budget_us && iteration && !(iteration & (MCTS_TIME_CHECK_ITERATIONS - 1)) && micros() - start_us >= budget_us)
+			{
+				break;
+			}
+
+			_iterate(own, other);
+		}
+
+		iteration_done = iteration;
+
+		for (child = arena[0].child; child != MCTS_NODE_NONE; child = arena[child].sibling)
+		{
+			if (best == MCTS_NODE_NONE || arena[child].visit > arena[best].visit)
+			{
+				best = child;
+			}
+		}
+
+		return arena[best].move;
+	}
+
+/**
+	* @brief  get random games played by search
+	* @return playout counter, it keeps adding up until reset_Playout
+	*/
+	uint32_t get_Playout(void)
+	{
+		return search_playout;
+	}
+
+/**
+	* @brief  clear playout counter
+	*/
+	void reset_Playout(void)
+	{
+		search_playout = 0;
+	}
+
+/**
+	* @brief  get iterations of the last BestNextMove
+	* @return 0 ~ MCTS_ITERATION_MAX, iterations which end in the tree play no random game
+	*/
+	uint16_t get_IterationDone(void)
+	{
+		return iteration_done;
+	}
+
+/**
+	* @brief  get nodes used by the last BestNextMove
+	* @return 1 ~ NODES
+	*/
+	uint16_t get_NodeUsed(void)
+	{
+		return node_used;
+	}
+
+/**
+	* @brief  get SRAM bytes of node arena
+	* @return bytes
+	*/
+	static uint16_t get_ArenaSize(void)
+	{
+		return sizeof(T_MCTS_NODE) * NODES;
+	}
+
+private:
+
+	/*! one position of the tree, children are a list through sibling */
+	typedef struct
+	{
+		uint16_t visit;        /*!< iterations through this node */
+		uint16_t score;        /*!< results in half points, in view of the one who made move, 2 * visit at most */
+		uint16_t child;        /*!< first child, MCTS_NODE_NONE if none */
+		uint16_t sibling;      /*!< next child of the same parent */
+		uint8_t  move;         /*!< cell taken from parent to this node */
+	} T_MCTS_NODE;
+
+	static T_BITMAP _bit(uint8_t cell)
+	{
+		return (T_BITMAP)1 << cell;
+	}
+
+	static T_BITMAP _full(void)
+	{
+		return (T_BITMAP)((T_BITMAP)~(T_BITMAP)0 >> (sizeof(T_BITMAP) * 8 - CELL_TOTAL));
+	}
+
+	uint32_t _random(void)
+	{
+		//xorshift32, much faster than random() on AVR
+		random_state ^= random_state << 13;
+		random_state ^= random_state >> 17;
+		random_state ^= random_state << 5;
+
+		return random_state;
+	}
+
+/**
+	* @brief  pick one cell of mask randomly
+	* @param  mask must not be 0
+	* @return cell
+	*/
+	uint8_t _random_cell(T_BITMAP mask)
+	{
+		uint8_t count = 0, cell = 0;
+
+		for (T_BITMAP n = mask; n; n &= n - 1, count++);
+
+		//drop the lowest cells, then take the lowest one left
+		for (count = _random() % count; count; count--)
+		{
+			mask &= mask - 1;
+		}
+
+		for (mask &= ~(mask - 1); !(mask & 1); mask >>= 1, cell++);
+
+		return cell;
+	}
+
+/**
+	* @brief  a line through cell is bingo or not
+	* @param  MatrixMap pieces of the one who just took cell
+	* @param  cell
+	*/
+	bool _is_bingo_at(T_BITMAP MatrixMap, uint8_t cell)
+	{
+		for (uint8_t line = 0; line < this->LINE_TOTAL; line++)
+		{
+			T_BITMAP line_mask = this->get_Line(line);
+
+			if ((line_mask & _bit(cell)) && (MatrixMap & line_mask) == line_mask)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+/**
+	* @brief  play randomly to the end of game
+	* @param  own pieces of the one to move
+	* @param  other
+	* @return result in view of the one to move
+	*/
+	uint8_t _playout(T_BITMAP own, T_BITMAP other)
+	{
+		bool own_turn = true;
+
+		search_playout++;
+
+		for (T_BITMAP empty = ~(own | other) & _full(); empty; empty = ~(own | other) & _full())
+		{
+			uint8_t move = _random_cell(empty);
+			T_BITMAP tmp;
+
+			own |= _bit(move);
+
+			if (_is_bingo_at(own, move))
+			{
+				return (own_turn) ? MCTS_RESULT_WIN : MCTS_RESULT_LOSE;
+			}
+
+			tmp = own;
+			own = other;
+			other = tmp;
+			own_turn = !own_turn;
+		}
+
+		return MCTS_RESULT_DRAW;
+	}
+
+/**
+	* @brief  MCTS_EXPLORATION * sqrt(ln(visit)), once for each node
+	* @param  visit must not be 0
+	* @return 8.8 fixed point
+	*/
+	static uint16_t _explore(uint16_t visit)
+	{
+		uint8_t log2 = 0, quarter;
+
+		for (uint16_t n = visit; n > 1; n >>= 1, log2++);
+
+		//2 bits under the leading one, 3 is 2 + 1 quarters up
+		quarter = (log2 >= 2) ? (visit >> (log2 - 2)) & 3 : (visit & 1) << 1;
+
+		return pgm_read_word(&mcts_explore[4 * log2 + quarter]);
+	}
+
+/**
+	* @brief  child of node with the best UCT value
+	* @param  node all moves of node have a child
+	*/
+	uint16_t _select(uint16_t node)
+	{
+		uint16_t explore = _explore(arena[node].visit);
+		uint16_t value, best_value = 0;
+		uint16_t best = MCTS_NODE_NONE;
+
+		for (uint16_t child = arena[node].child; child != MCTS_NODE_NONE; child = arena[child].sibling)
+		{
+			uint16_t visit = arena[child].visit, score = arena[child].score, n = visit;
+			uint8_t shift = 12;
+
+			//mean in 8.8, visit under 128 keeps score << 7 in 16 bits
+			for (; visit >= 128; visit >>= 1, score >>= 1);
+
+			value = ((score << 7) / visit);
+
+			//1 / sqrt(n) from table, every n / 4 is one more bit of shift
+			for (; n > 64; n = (n + 2) >> 2, shift++);
+
+			value += ((uint32_t)explore * pgm_read_word(&mcts_inv_sqrt[n])) >> shift;
+
+			if (best == MCTS_NODE_NONE || value > best_value)
+			{
+				best_value = value;
+				best = child;
+			}
+		}
+
+		return best;
+	}
+
+/**
+	* @brief  one iteration: select, expand, playout and update
+	* @param  own pieces of the one to move at root
+	* @param  other
+	*/
+	void _iterate(T_BITMAP own, T_BITMAP other)
+	{
+		uint16_t path[CELL_TOTAL + 1];
+		uint16_t node = 0;
+		uint8_t depth = 0, result = MCTS_RESULT_DRAW;
+		bool done = false;
+
+		path[depth++] = node;
+
+		//own is the one to move at node, result is in view of the one who moved to node
+		while (!done)
+		{
+			T_BITMAP empty = ~(own | other) & _full();
+			T_BITMAP tried = 0, tmp;
+			bool expand;
+			uint8_t move;
+
+			if (!empty)
+			{
+				result = MCTS_RESULT_DRAW;
+				done = true;
+				break;
+			}
+
+			for (uint16_t child = arena[node].child; child != MCTS_NODE_NONE; child = arena[child].sibling)
+			{
+				tried |= _bit(arena[child].move);
+			}
+
+			expand = (empty & ~tried) != 0;
+
+			if (expand && node_used < NODES)
+			{
+				uint16_t child = node_used++;
+
+				move = _random_cell(empty & ~tried);
+
+				arena[child].visit = 0;
+				arena[child].score = 0;
+				arena[child].child = MCTS_NODE_NONE;
+				arena[child].sibling = arena[node].child;
+				arena[child].move = move;
+				arena[node].child = child;
+
+				node = child;
+			}
+			else if (!expand)
+			{
+				node = _select(node);
+				move = arena[node].move;
+			}
+			else
+			{
+				break;  //arena full, play from this leaf
+			}
+
+			path[depth++] = node;
+			own |= _bit(move);
+
+			if (_is_bingo_at(own, move))
+			{
+				result = MCTS_RESULT_WIN;
+				done = true;
+				break;
+			}
+
+			tmp = own;
+			own = other;
+			other = tmp;
+
+			if (expand)
+			{
+				break;  //new node, play from here
+			}
+		}
+
+		if (!done)
+		{
+			result = MCTS_RESULT_WIN - _playout(own, other);
+		}
+
+		while (depth--)
+		{
+			arena[path[depth]].visit++;
+			arena[path[depth]].score += result;
+			result = MCTS_RESULT_WIN - result;
+		}
+	}
+
+	/** tree nodes, node 0 is root */
+	T_MCTS_NODE arena[NODES];
+
+	/** nodes taken from arena */
+	uint16_t node_used;
+
+	/** iterations of BestNextMove, 0 means only time budget */
+	uint16_t iteration_limit;
+
+	/** iterations of the last BestNextMove */
+	uint16_t iteration_done;
+
+	/** random games played */
+	uint32_t search_playout;
+
+	/** state of xorshift32 */
+	uint32_t random_state;
+};
+
+#endif  //EE33_MCTS_H
+
+
+/*
+ * @release note
+ * | v1.0 2026-10-16 - 3lectron3ats : Initial Release
+ * #
+*/
@@ -0,0 +1,743 @@
+/**
+  * @file      EE33_Minmax.cpp
+  * @version   v1.0
+  * @author    3lectron3ats <3lectron3ats@gmail.com>
+  * @date      2026.10.16
+  * @brief     Minmax search engine of Tic-Tac-Toe on bitmaps.
+  * @copyright GPL v3.0
+  * *************************************************************************************
+  * @attention
+  * <h2><center>&copy; COPYRIGHT 2023 3lectron3ats </center></h2>
+  * *************************************************************************************
+  */
+
+#include <EE33_Tic_Tac_Toe.h>
+#include <EE33_Minmax.h>
+#include <EE33_Symmetry.h>
+
+/** center, corners, then edges */
+const uint8_t minmax_static_order[MATRIX_3X3_ELEMENT_TOTAL] PROGMEM =
+{
+	MATRIX_3X3_M22,
+	MATRIX_3X3_M11, MATRIX_3X3_M13, MATRIX_3X3_M31, MATRIX_3X3_M33,
+	MATRIX_3X3_M12, MATRIX_3X3_M21, MATRIX_3X3_M23, MATRIX_3X3_M32,
+};
+
+MinmaxEngine::MinmaxEngine()
+{
+	minmax_move_order = MINMAX_ORDER_HEURISTIC;
+	memset(minmax_killer, MATRIX_3X3_ELEMENT_TOTAL, sizeof(minmax_killer));
+	memset(minmax_history, 0, sizeof(minmax_history));
+	reset_SearchStats();
+
+#if MINMAX_MOVE_STATS
+	memset(&minmax_move_stats, 0, sizeof(minmax_move_stats));
+	minmax_depth_max = 0;
+#endif
+
+	minmax_horizon = MATRIX_3X3_ELEMENT_TOTAL;
+	minmax_abort = false;
+	minmax_budget_us = 0;
+	minmax_start_us = 0;
+	minmax_frame = &minmax_stack[0];
+
+	ponderStop();
+}
+
+void MinmaxEngine::flush(void)
+{
+	minmax_cache.flush();
+}
+
+MATRIX_3X3_ELEMENT MinmaxEngine::BestNextMove(T_MATRIX_3X3 MatrixMap_Friend, T_MATRIX_3X3 MatrixMap_Enmy, uint16_t hash, uint32_t budget_us)
+{
+	MATRIX_3X3_ELEMENT result;
+	uint16_t moves;
+
+#if MINMAX_MOVE_STATS
+	_move_stats_begin();
+#endif
+
+	moves = _ponder_read(MatrixMap_Friend, MatrixMap_Enmy);
+
+	if (moves)
+	{
+		result = pick(moves);
+	}
+	else
+	{
+		for (uint8_t i = 0; i < MATRIX_3X3_ELEMENT_TOTAL; i++)
+		{
+			minmax_history[i] >>= 1;  //older cutoffs count less
+		}
+
+		result = _BestNextMove_Wrapper(MatrixMap_Friend, MatrixMap_Enmy, hash, PLAYER_TYPE_FRIEND, budget_us);
+	}
+
+#if MINMAX_MOVE_STATS
+	_move_stats_end();
+#endif
+
+	return result;
+}
+
+uint16_t MinmaxEngine::ScoreAllMoves(T_MATRIX_3X3 MatrixMap_Friend, T_MATRIX_3X3 MatrixMap_Enmy, uint16_t hash, int8_t scores[MATRIX_3X3_ELEMENT_TOTAL])
+{
+	uint8_t SymmetryMask = MatrixSymmetry::stabilizer(MatrixMap_Friend, MatrixMap_Enmy);
+	uint16_t moves = MatrixBit::empty(MatrixMap_Friend, MatrixMap_Enmy);
+	int8_t ScoreMinMax = MINMAX_SCORE_NONE;
+	uint16_t BestMoves = 0;
+
+#if MINMAX_MOVE_STATS
+	_move_stats_begin();
+#endif
+
+	ponderStop();  //search is going to take minmax_stack
+
+	minmax_abort = false;
+	minmax_budget_us = 0;
+	minmax_horizon = MATRIX_3X3_ELEMENT_TOTAL;
+
+	memset(scores, MINMAX_SCORE_NONE, MATRIX_3X3_ELEMENT_TOTAL);
+
+	while (moves)
+	{
+		MATRIX_3X3_ELEMENT index = MatrixBit::pop(&moves);
+		MATRIX_3X3_ELEMENT SymmetricMove = _symmetric_element(index, SymmetryMask);
+		T_MATRIX_3X3 MatrixMap = MatrixMap_Friend;
+
+		MatrixMap.d16 |= MatrixBit::mask(index);
+
+		if (SymmetricMove < index)
+		{
+			scores[index] = scores[SymmetricMove];
+		}
+		else
+		{
+			scores[index] = -_minmax(MatrixMap_Enmy, MatrixMap, hash ^ MatrixHash::key(PLAYER_TYPE_FRIEND, index) ^ MATRIX_HASH_TURN,
+			                         -MINMAX_SCORE_INFINITE, MINMAX_SCORE_INFINITE, PLAYER_TYPE_ENMY);
+		}
+
+		if (scores[index] > ScoreMinMax)
+		{
+			ScoreMinMax = scores[index];
+			BestMoves = MatrixBit::mask(index);
+		}
+		else if (scores[index] == ScoreMinMax)
+		{
+			BestMoves |= MatrixBit::mask(index);
+		}
+	}
+
+#if MINMAX_MOVE_STATS
+	_move_stats_end();
+#endif
+
+	return BestMoves;
+}
+
+MATRIX_3X3_ELEMENT MinmaxEngine::pick(uint16_t BestMoves)
+{
+	int32_t NextMoveChoose;
+
+	NextMoveChoose = (int32_t)random(MatrixBit::count(BestMoves));
+
+	for (; NextMoveChoose > 0; NextMoveChoose--)
+	{
+		BestMoves &= BestMoves - 1;  //skip the smallest
+	}
+
+	return MatrixBit::lowest(BestMoves);
+}
+
+void MinmaxEngine::ponderStart(T_MATRIX_3X3 MatrixMap_Friend, T_MATRIX_3X3 MatrixMap_Enmy, uint16_t hash)
+{
+	ponderStop();
+
+	ponder.map_friend = MatrixMap_Friend;
+	ponder.map_enmy = MatrixMap_Enmy;
+	ponder.hash = hash;
+	ponder.active = true;
+}
+
+void MinmaxEngine::ponderRoutine(T_MATRIX_3X3 MatrixMap_Friend, T_MATRIX_3X3 MatrixMap_Enmy, uint32_t slice_us)
+{
+	if (!ponder.active)
+	{
+		return;
+	}
+
+	if (MatrixMap_Friend.d16 != ponder.map_friend.d16 || MatrixMap_Enmy.d16 != ponder.map_enmy.d16)
+	{
+		ponderStop();  //position changed, replies are useless
+		return;
+	}
+
+	uint16_t empty = ~(ponder.map_friend.d16 | ponder.map_enmy.d16) & MATRIX_3X3_MASK;
+	T_MATRIX_3X3 map_friend, map_enmy;
+	int8_t score;
+
+	minmax_abort = false;
+	minmax_budget_us = slice_us;
+	minmax_start_us = micros();
+	minmax_horizon = MATRIX_3X3_ELEMENT_TOTAL;
+
+	while (!minmax_abort)
+	{
+		if (ponder.enmy_move == MATRIX_3X3_ELEMENT_TOTAL)
+		{
+			uint16_t todo = empty & ~ponder.done;
+
+			if (!todo)
+			{
+				break;  //all replies are ready
+			}
+
+			if (ponder.hint < MATRIX_3X3_ELEMENT_TOTAL && (todo & MatrixBit::mask(ponder.hint)))
+			{
+				ponder.enmy_move = ponder.hint;
+			}
+			else
+			{
+				for (uint8_t i = 0; !(todo & MatrixBit::mask(ponder.enmy_move = pgm_read_byte(&minmax_static_order[i]))); i++);
+			}
+
+			ponder.friend_move = MATRIX_3X3_M11;
+			ponder.best = -MINMAX_SCORE_INFINITE;
+			ponder.reply[ponder.enmy_move] = 0;
+		}
+
+		map_friend = ponder.map_friend;
+		map_enmy.d16 = ponder.map_enmy.d16 | MatrixBit::mask(ponder.enmy_move);
+
+		if (!ponder.running)
+		{
+			//next empty element, none if enmy won
+			ponder.friend_move = MatrixBit::lowest(empty & ~MatrixBit::mask(ponder.enmy_move) & ~(MatrixBit::mask(ponder.friend_move) - 1));
+
+			if (ponder.friend_move == MATRIX_3X3_ELEMENT_TOTAL || MatrixLine::Is_Bingo(map_enmy))
+			{
+				ponder.done |= MatrixBit::mask(ponder.enmy_move);
+				ponder.enmy_move = MATRIX_3X3_ELEMENT_TOTAL;
+				continue;
+			}
+
+			map_friend.d16 |= MatrixBit::mask(ponder.friend_move);
+
+			uint16_t hash = ponder.hash ^ MatrixHash::key(PLAYER_TYPE_ENMY, ponder.enmy_move) ^ MatrixHash::key(PLAYER_TYPE_FRIEND, ponder.friend_move) ^ MATRIX_HASH_TURN;
+
+			_minmax_begin(map_enmy, map_friend, hash, -MINMAX_SCORE_INFINITE, MINMAX_SCORE_INFINITE, PLAYER_TYPE_ENMY);
+			ponder.running = true;
+		}
+
+		if (_minmax_resume(&score))
+		{
+			ponder.running = false;
+			score = -score;  //enmy to move, score in view of friend
+
+			if (score > ponder.best)
+			{
+				ponder.best = score;
+				ponder.reply[ponder.enmy_move] = MatrixBit::mask(ponder.friend_move);
+			}
+			else if (score == ponder.best)
+			{
+				ponder.reply[ponder.enmy_move] |= MatrixBit::mask(ponder.friend_move);
+			}
+
+			ponder.friend_move++;
+		}
+	}
+
+	minmax_budget_us = 0;
+}
+
+void MinmaxEngine::ponderStop(void)
+{
+	ponder.active = false;
+	ponder.done = 0;
+	ponder.enmy_move = MATRIX_3X3_ELEMENT_TOTAL;
+	ponder.hint = MATRIX_3X3_ELEMENT_TOTAL;
+	ponder.running = false;
+}
+
+void MinmaxEngine::set_PonderHint(MATRIX_3X3_ELEMENT element)
+{
+	ponder.hint = element;
+}
+
+bool MinmaxEngine::get_PonderReply(MATRIX_3X3_ELEMENT element, uint16_t *moves)
+{
+	if (!ponder.active || !(ponder.done & MatrixBit::mask(element)))
+	{
+		return false;
+	}
+
+	*moves = ponder.reply[element];
+
+	return true;
+}
+
+void MinmaxEngine::set_MoveOrder(MINMAX_MOVE_ORDER order)
+{
+	minmax_move_order = order;
+}
+
+void MinmaxEngine::get_SearchStats(T_MINMAX_SEARCH_STATS *stats)
+{
+	*stats = minmax_stats;
+}
+
+void MinmaxEngine::reset_SearchStats(void)
+{
+	memset(&minmax_stats, 0, sizeof(minmax_stats));
+}
+
+void MinmaxEngine::get_CacheStats(T_MINMAX_CACHE_STATS *stats)
+{
+	minmax_cache.get_Stats(stats);
+}
+
+void MinmaxEngine::reset_CacheStats(void)
+{
+	minmax_cache.reset_Stats();
+}
+
+#if MINMAX_MOVE_STATS
+void MinmaxEngine::get_MoveStats(T_MINMAX_MOVE_STATS *stats)
+{
+	*stats = minmax_move_stats;
+}
+#endif
+
+uint16_t MinmaxEngine::get_SearchStackSize(void)
+{
+	return sizeof(minmax_stack);
+}
+
+#if MINMAX_MOVE_STATS
+void MinmaxEngine::_move_stats_begin(void)
+{
+	T_MINMAX_CACHE_STATS CacheStats;
+
+	minmax_cache.get_Stats(&CacheStats);
+
+	//start values for now, _move_stats_end takes the difference
+	minmax_move_stats.node = minmax_stats.node;
+	minmax_move_stats.cutoff = minmax_stats.cutoff;
+	minmax_move_stats.cache_hit = CacheStats.hit;
+	minmax_move_stats.elapsed_us = micros();
+	minmax_depth_max = 0;
+}
+
+void MinmaxEngine::_move_stats_end(void)
+{
+	T_MINMAX_CACHE_STATS CacheStats;
+
+	minmax_cache.get_Stats(&CacheStats);
+
+	minmax_move_stats.node = minmax_stats.node - minmax_move_stats.node;
+	minmax_move_stats.cutoff = minmax_stats.cutoff - minmax_move_stats.cutoff;
+	minmax_move_stats.cache_hit = CacheStats.hit - minmax_move_stats.cache_hit;
+	minmax_move_stats.elapsed_us = micros() - minmax_move_stats.elapsed_us;
+	minmax_move_stats.depth = minmax_depth_max;
+}
+#endif
+
+uint16_t MinmaxEngine::_ponder_read(T_MATRIX_3X3 MatrixMap_Friend, T_MATRIX_3X3 MatrixMap_Enmy)
+{
+	uint16_t moves = 0;
+	uint16_t enmy_move = MatrixMap_Enmy.d16 & ~ponder.map_enmy.d16;
+
+	//exactly one more enmy piece since ponderStart
+	if (ponder.active && MatrixMap_Friend.d16 == ponder.map_friend.d16 &&
+		(MatrixMap_Enmy.d16 & ponder.map_enmy.d16) == ponder.map_enmy.d16 &&
+		enmy_move && !(enmy_move & (enmy_move - 1)) && (ponder.done & enmy_move))
+	{
+		moves = ponder.reply[MatrixBit::lowest(enmy_move)];
+	}
+
+	ponderStop();  //search is going to take minmax_stack
+
+	return moves;
+}
+
+int8_t MinmaxEngine::_minmax_cal_score(T_MATRIX_3X3 MatrixMap_Own, T_MATRIX_3X3 MatrixMap_Other)
+{
+	uint8_t line_own = MatrixLine::get_BingoLine(MatrixMap_Own);
+	uint8_t line_other = MatrixLine::get_BingoLine(MatrixMap_Other);
+
+	if (!(line_own | line_other))
+	{
+		return 0;  //nobody win, most of the nodes
+	}
+
+	return MINMAX_SCORE_LINE * ((int8_t)MatrixBit::count(line_own) - (int8_t)MatrixBit::count(line_other));
+}
+
+int8_t MinmaxEngine::_minmax_evaluate(T_MATRIX_3X3 MatrixMap_Own, T_MATRIX_3X3 MatrixMap_Other)
+{
+	uint8_t open_own = MatrixLine::get_OpenLine(MatrixMap_Own, MatrixMap_Other);
+	uint8_t open_other = MatrixLine::get_OpenLine(MatrixMap_Other, MatrixMap_Own);
+
+	//at most LINE_SEQ_TOTAL, never reaches MINMAX_SCORE_LINE
+	return (int8_t)MatrixBit::count(open_own) - (int8_t)MatrixBit::count(open_other);
+}
+
+MATRIX_3X3_ELEMENT MinmaxEngine::_BestNextMove_Wrapper(T_MATRIX_3X3 MatrixMap_Friend, T_MATRIX_3X3 MatrixMap_Enmy, uint16_t hash, PLAYER_TYPE WhoseTurn, uint32_t budget_us)
+{
+	if (MatrixBit::Is_Full(MatrixMap_Friend, MatrixMap_Enmy))
+	{
+		return MATRIX_3X3_ELEMENT_TOTAL;
+	}
+
+	if (!(MatrixMap_Friend.d16 | MatrixMap_Enmy.d16))
+	{
+		return random(MATRIX_3X3_ELEMENT_TOTAL);
+	}
+
+	uint16_t BestMoves = 0, moves;
+
+	minmax_abort = false;
+	minmax_budget_us = 0;  //first round is never stopped, there must be a move
+	minmax_start_us = micros();
+
+	//without budget, one round to the end of game
+	minmax_horizon = (budget_us) ? MatrixBit::count(MatrixMap_Friend.d16 | MatrixMap_Enmy.d16) + 1 : MATRIX_3X3_ELEMENT_TOTAL;
+
+	for (; minmax_horizon <= MATRIX_3X3_ELEMENT_TOTAL; minmax_horizon++)
+	{
+		moves = (WhoseTurn == PLAYER_TYPE_FRIEND) ? _minmax_root(MatrixMap_Friend, MatrixMap_Enmy, hash, WhoseTurn)
+		                                          : _minmax_root(MatrixMap_Enmy, MatrixMap_Friend, hash, WhoseTurn);
+
+		if (minmax_abort)
+		{
+			break;
+		}
+
+		BestMoves = moves;
+		minmax_budget_us = budget_us;
+	}
+
+	minmax_budget_us = 0;
+
+	return pick(BestMoves);
+}
+
+uint16_t MinmaxEngine::_minmax_root(T_MATRIX_3X3 MatrixMap_Own, T_MATRIX_3X3 MatrixMap_Other, uint16_t hash, PLAYER_TYPE WhoseTurn)
+{
+	uint16_t moves = MatrixBit::empty(MatrixMap_Own, MatrixMap_Other);
+	PLAYER_TYPE NextTurn = (WhoseTurn == PLAYER_TYPE_FRIEND) ? PLAYER_TYPE_ENMY : PLAYER_TYPE_FRIEND;
+	int8_t ScoreMinMax = -MINMAX_SCORE_INFINITE;
+	uint16_t BestMoves = 0;
+
+	//moves symmetric to a searched move get the same score
+	int8_t ScoreList[MATRIX_3X3_ELEMENT_TOTAL];
+	uint8_t SymmetryMask = MatrixSymmetry::stabilizer(MatrixMap_Own, MatrixMap_Other);
+
+	while (moves && !minmax_abort)
+	{
+		MATRIX_3X3_ELEMENT index = MatrixBit::pop(&moves);
+		MATRIX_3X3_ELEMENT SymmetricMove = _symmetric_element(index, SymmetryMask);
+		uint16_t ChildHash = hash ^ MatrixHash::key(WhoseTurn, index) ^ MATRIX_HASH_TURN;
+		T_MATRIX_3X3 MatrixMap = MatrixMap_Own;
+		int8_t score;
+
+		MatrixMap.d16 |= MatrixBit::mask(index);
+
+		//child scores are in view of the other one, so windows are turned over and negated
+		if (SymmetricMove < index)
+		{
+			score = ScoreList[SymmetricMove];
+		}
+		else if (ScoreMinMax == -MINMAX_SCORE_INFINITE)
+		{
+			score = -_minmax(MatrixMap_Other, MatrixMap, ChildHash, -MINMAX_SCORE_INFINITE, MINMAX_SCORE_INFINITE, NextTurn);
+		}
+		else
+		{
+			//only best score is inside the window, so a score inside is an exact tie,
+			//score outside only tells worse or better
+			score = -_minmax(MatrixMap_Other, MatrixMap, ChildHash, -ScoreMinMax - 1, -ScoreMinMax + 1, NextTurn);
+
+			if (score > ScoreMinMax)
+			{
+				//better, get the exact score
+				score = -_minmax(MatrixMap_Other, MatrixMap, ChildHash, -MINMAX_SCORE_INFINITE, -ScoreMinMax, NextTurn);
+			}
+		}
+
+		ScoreList[index] = score;
+
+		if (score > ScoreMinMax)
+		{
+			ScoreMinMax = score;
+			BestMoves = MatrixBit::mask(index);
+		}
+		else if (score == ScoreMinMax)
+		{
+			BestMoves |= MatrixBit::mask(index);
+		}
+	}
+
+	return BestMoves;
+}
+
+MATRIX_3X3_ELEMENT MinmaxEngine::_symmetric_element(MATRIX_3X3_ELEMENT element, uint8_t SymmetryMask)
+{
+	MATRIX_SYMMETRY symmetry;
+	MATRIX_3X3_ELEMENT result = element;
+
+	for (symmetry = MATRIX_SYMMETRY_ROTATE_90; symmetry < MATRIX_SYMMETRY_TOTAL; symmetry = symmetry + 1)
+	{
+		if (SymmetryMask & bit(symmetry))
+		{
+			MATRIX_3X3_ELEMENT candidate = MatrixSymmetry::transform_element(element, symmetry);
+
+			result = (candidate < result) ? candidate : result;
+		}
+	}
+
+	return result;
+}
+
+uint16_t MinmaxEngine::_minmax_threat(T_MATRIX_3X3 MatrixMap, uint16_t empty)
+{
+	uint16_t result = 0;
+
+	while (empty)
+	{
+		uint16_t move = empty & -empty;  //smallest empty element
+		T_MATRIX_3X3 map;
+
+		empty ^= move;
+		map.d16 = MatrixMap.d16 | move;
+		result |= MatrixLine::Is_Bingo(map) ? move : 0;
+	}
+
+	return result;
+}
+
+MATRIX_3X3_ELEMENT MinmaxEngine::_minmax_next_move(T_MINMAX_FRAME *frame)
+{
+	MATRIX_3X3_ELEMENT index, result = MATRIX_3X3_ELEMENT_TOTAL;
+	uint16_t candidate = frame->remaining;
+	uint16_t win = frame->win, block = frame->block;
+	uint8_t ply = frame->ply;
+
+	if (minmax_move_order == MINMAX_ORDER_INDEX)
+	{
+		result = MatrixBit::lowest(candidate);
+	}
+	else
+	{
+		candidate = (candidate & win) ? (candidate & win) : (candidate & block) ? (candidate & block) : candidate;
+
+		if (minmax_killer[ply] < MATRIX_3X3_ELEMENT_TOTAL && (candidate & MatrixBit::mask(minmax_killer[ply])))
+		{
+			result = minmax_killer[ply];
+		}
+		else
+		{
+			for (uint8_t i = 0; i < MATRIX_3X3_ELEMENT_TOTAL; i++)
+			{
+				index = pgm_read_byte(&minmax_static_order[i]);
+
+				if ((candidate & MatrixBit::mask(index)) && (result == MATRIX_3X3_ELEMENT_TOTAL || minmax_history[index] > minmax_history[result]))
+				{
+					result = index;
+				}
+			}
+		}
+	}
+
+	frame->remaining &= ~MatrixBit::mask(result);
+
+	return result;
+}
+
+void MinmaxEngine::_minmax_record_cutoff(MATRIX_3X3_ELEMENT move, uint8_t ply)
+{
+	minmax_stats.cutoff++;
+
+	minmax_killer[ply] = move;
+
+	//cutoff near root saves more nodes
+	minmax_history[move] = (minmax_history[move] > 255 - (MATRIX_3X3_ELEMENT_TOTAL - ply)) ? 255 : minmax_history[move] + (MATRIX_3X3_ELEMENT_TOTAL - ply);
+}
+
+void MinmaxEngine::_minmax_enter(T_MINMAX_FRAME *frame, uint16_t map_own, uint16_t map_other, uint16_t hash, int8_t alpha_score, int8_t beta_score, PLAYER_TYPE WhoseTurn)
+{
+	T_MATRIX_3X3 MatrixMap_Own, MatrixMap_Other;
+	uint16_t empty = ~(map_own | map_other) & MATRIX_3X3_MASK;
+	int8_t score;
+
+	minmax_stats.node++;
+
+#if MINMAX_MOVE_STATS
+	//frame n is n + 1 pieces after the searched position
+	if (frame - &minmax_stack[0] + 1 > minmax_depth_max)
+	{
+		minmax_depth_max = frame - &minmax_stack[0] + 1;
+	}
+#endif
+
+	if (minmax_budget_us && !(minmax_stats.node & (MINMAX_TIME_CHECK_NODES - 1)) && micros() - minmax_start_us >= minmax_budget_us)
+	{
+		minmax_abort = true;
+	}
+
+	MatrixMap_Own.d16 = map_own;
+	MatrixMap_Other.d16 = map_other;
+
+	frame->map_own = map_own;
+	frame->map_other = map_other;
+	frame->hash = hash;
+	frame->turn = WhoseTurn;
+	frame->move = MINMAX_MOVE_NONE;
+	frame->remaining = 0;
+
+	score = _minmax_cal_score(MatrixMap_Own, MatrixMap_Other);
+
+	if (score || !empty)
+	{
+		//someone win or tie
+		frame->best = score;
+		return;
+	}
+
+	frame->ply = MATRIX_3X3_ELEMENT_TOTAL - MatrixBit::count(empty);
+
+	if (frame->ply >= minmax_horizon)
+	{
+		frame->best = _minmax_evaluate(MatrixMap_Own, MatrixMap_Other);
+		return;
+	}
+
+	frame->origin = alpha_score;
+
+#if MINMAX_CACHE_SIZE
+	MINMAX_BOUND CacheBound;
+
+	//turn is in the key, so own and other always stand for the same players
+	if (minmax_cache.probe(MinmaxCache::key(MatrixMap_Own, MatrixMap_Other, WhoseTurn), hash, minmax_horizon - frame->ply, &score, &CacheBound))
+	{
+		if (CacheBound == MINMAX_BOUND_EXACT)
+		{
+			frame->best = score;
+			return;
+		}
+
+		alpha_score = (CacheBound == MINMAX_BOUND_LOWER && score > alpha_score) ? score : alpha_score;
+		beta_score = (CacheBound == MINMAX_BOUND_UPPER && score < beta_score) ? score : beta_score;
+
+		if (beta_score <= alpha_score)
+		{
+			frame->best = score;
+			return;
+		}
+	}
+#endif
+
+	frame->alpha = alpha_score;
+	frame->beta = beta_score;
+	frame->best = -MINMAX_SCORE_INFINITE;
+	frame->remaining = empty;
+	frame->win = 0;
+	frame->block = 0;
+
+	if (minmax_move_order == MINMAX_ORDER_HEURISTIC)
+	{
+		frame->win = _minmax_threat(MatrixMap_Own, empty);
+		frame->block = _minmax_threat(MatrixMap_Other, empty);
+	}
+}
+
+void MinmaxEngine::_minmax_begin(T_MATRIX_3X3 MatrixMap_Own, T_MATRIX_3X3 MatrixMap_Other, uint16_t hash, int8_t alpha_score, int8_t beta_score, PLAYER_TYPE WhoseTurn)
+{
+	minmax_frame = &minmax_stack[0];
+
+	_minmax_enter(minmax_frame, MatrixMap_Own.d16, MatrixMap_Other.d16, hash, alpha_score, beta_score, WhoseTurn);
+}
+
+bool MinmaxEngine::_minmax_resume(int8_t *score)
+{
+	T_MINMAX_FRAME *frame = minmax_frame;
+
+	while (!minmax_abort)
+	{
+		if (frame->remaining)
+		{
+			//go down to the position after next move, the other one is to move there
+			MATRIX_3X3_ELEMENT index = _minmax_next_move(frame);
+			uint16_t hash = frame->hash ^ MatrixHash::key((PLAYER_TYPE)frame->turn, index) ^ MATRIX_HASH_TURN;
+
+			frame->move = index;
+
+			_minmax_enter(frame + 1, frame->map_other, frame->map_own | MatrixBit::mask(index), hash, -frame->beta, -frame->alpha,
+			              (frame->turn == PLAYER_TYPE_FRIEND) ? PLAYER_TYPE_ENMY : PLAYER_TYPE_FRIEND);
+
+			frame++;
+			continue;
+		}
+
+		//all moves searched or cut, score of this position is known
+		*score = frame->best;
+
+#if MINMAX_CACHE_SIZE
+		if (frame->move != MINMAX_MOVE_NONE)
+		{
+			T_MATRIX_3X3 map_own, map_other;
+			MINMAX_BOUND CacheBound = (*score <= frame->origin) ? MINMAX_BOUND_UPPER : (*score >= frame->beta) ? MINMAX_BOUND_LOWER : MINMAX_BOUND_EXACT;
+
+			map_own.d16 = frame->map_own;
+			map_other.d16 = frame->map_other;
+
+			minmax_cache.store(MinmaxCache::key(map_own, map_other, (PLAYER_TYPE)frame->turn), frame->hash, minmax_horizon - frame->ply, *score, CacheBound);
+		}
+#endif
+
+		if (frame == &minmax_stack[0])
+		{
+			return true;
+		}
+
+		//go back to the parent and take the score in its view
+		frame--;
+		*score = -*score;
+
+		frame->best = (*score > frame->best) ? *score : frame->best;
+		frame->alpha = (*score > frame->alpha) ? *score : frame->alpha;
+
+		if (frame->beta <= frame->alpha)
+		{
+			_minmax_record_cutoff((MATRIX_3X3_ELEMENT)frame->move, frame->ply);
+			frame->remaining = 0;
+		}
+	}
+
+	minmax_frame = frame;  //out of time, continue from here
+
+	return false;
+}
+
+int8_t MinmaxEngine::_minmax(T_MATRIX_3X3 MatrixMap_Own, T_MATRIX_3X3 MatrixMap_Other, uint16_t hash, int8_t alpha_score, int8_t beta_score, PLAYER_TYPE WhoseTurn)
+{
+	int8_t score;
+
+	_minmax_begin(MatrixMap_Own, MatrixMap_Other, hash, alpha_score, beta_score, WhoseTurn);
+
+	if (!_minmax_resume(&score))
+	{
+		score = 0;  //out of time, caller drops the score
+	}
+
+	return score;
+}
+
+
+/*
+ * @release note
+ * | v1.0 2026-10-16 - 3lectron3ats : Initial Release
+ * #
+*/
@@ -0,0 +1,443 @@
+/**
+  * @file      EE33_Minmax.h
+  * @version   v1.0
+  * @author    3lectron3ats <3lectron3ats@gmail.com>
+  * @date      2026.10.16
+  * @brief     Minmax search engine of Tic-Tac-Toe on bitmaps.
+  * @copyright GPL v3.0
+  * *************************************************************************************
+  * @attention
+  * <h2><center>&copy; COPYRIGHT 2023 3lectron3ats </center></h2>
+  * *************************************************************************************
+  * @note
+  *   Engine only knows the maps of friend(the next one to move) and enmy, it does not
+  *   touch any pin, timer or serial port. All of its state is inside the object and
+  *   nothing is allocated, so every engine object searches on its own, for example
+  *   one for each game on the host. LED_SQUARE keeps one and passes its LED bitmaps.
+  *   Position hash is given by the caller, it can be kept up to date piece by piece,
+  *   or calculated by MatrixHash::hash(friend, enmy, PLAYER_TYPE_FRIEND).
+  *   MINMAX_CACHE_SIZE, MINMAX_MOVE_STATS and MINMAX_STACK_BUDGET are set for the whole
+  *   build, not per sketch, see EE33_MinmaxConfig.h.
+  */
+
+
+#ifndef EE33_MINMAX_H
+#define EE33_MINMAX_H
+
+// Arduino versioning.
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "Arduino.h"	// for digitalRead, digitalWrite, etc
+#else
+#include "WProgram.h"
+#endif
+
+#include <EE33_Matrix.h>
+#include <EE33_MinmaxConfig.h>
+#include <EE33_MinmaxCache.h>
+
+#define MINMAX_VERSION_MAJOR  1
+#define MINMAX_VERSION_MINOR  0
+
+/*! order of moves tried in minmax search */
+typedef enum
+{
+	MINMAX_ORDER_INDEX = 0,    /*!< MATRIX_3X3_M11 to MATRIX_3X3_M33 */
+	MINMAX_ORDER_HEURISTIC,    /*!< win, block, killer move, then center, corner, edge by history */
+} MINMAX_MOVE_ORDER;
+
+typedef struct
+{
+	uint32_t node;             /*!< positions visited by search */
+	uint32_t cutoff;           /*!< positions cut by alpha-beta pruning */
+} T_MINMAX_SEARCH_STATS;
+
+/*! cost of one BestNextMove or ScoreAllMoves, see MINMAX_MOVE_STATS */
+typedef struct
+{
+	uint32_t node;             /*!< positions visited */
+	uint32_t cutoff;           /*!< positions cut by alpha-beta pruning */
+	uint32_t cache_hit;        /*!< positions found in cache */
+	uint32_t elapsed_us;       /*!< micros() from call to return */
+	uint8_t  depth;            /*!< deepest search, in pieces put after the position */
+} T_MINMAX_MOVE_STATS;
+
+/** score of one bingo line, scores are kept in 8 bits */
+#define MINMAX_SCORE_LINE        16
+
+/** bigger than any score, bound of the full alpha-beta window */
+#define MINMAX_SCORE_INFINITE    127
+
+/** score of an occupied element, lower than any score */
+#define MINMAX_SCORE_NONE        (-MINMAX_SCORE_INFINITE - 1)
+
+/** search frames, one for each piece put on matrix plus the starting position */
+#define MINMAX_STACK_DEPTH       (MATRIX_3X3_ELEMENT_TOTAL + 1)
+
+/** nodes between two checks of the time budget, must be power of 2 */
+#define MINMAX_TIME_CHECK_NODES  32
+
+/** frame move of a position scored without searching any move */
+#define MINMAX_MOVE_NONE         0x0F
+
+/*! one position of the iterative negamax search, scores are in view of the one to move */
+typedef struct
+{
+	uint32_t map_own    : 9;   /*!< board of the one to move */
+	uint32_t map_other  : 9;   /*!< board of the other one */
+	uint32_t remaining  : 9;   /*!< moves not searched yet */
+	uint32_t move       : 4;   /*!< move being searched, MINMAX_MOVE_NONE if none */
+	uint32_t turn       : 1;   /*!< PLAYER_TYPE of the one to move, for hash and cache key */
+	uint32_t win        : 9;   /*!< moves which win at once */
+	uint32_t block      : 9;   /*!< moves which stop the other one to win at once */
+	uint32_t ply        : 4;   /*!< number of pieces on matrix */
+	uint32_t hash       : 10;  /*!< position hash, see MatrixHash */
+	int8_t   alpha;
+	int8_t   beta;
+	int8_t   best;             /*!< best score of searched moves */
+	int8_t   origin;           /*!< alpha before search, decides cache bound */
+} T_MINMAX_FRAME;
+
+static_assert(sizeof(T_MINMAX_FRAME) * MINMAX_STACK_DEPTH <= MINMAX_STACK_BUDGET, "minmax search stack is over MINMAX_STACK_BUDGET");
+
+/*! search during the other one's turn, see MinmaxEngine::ponderStart */
+typedef struct
+{
+	T_MATRIX_3X3 map_friend;   /*!< position when pondering started */
+	T_MATRIX_3X3 map_enmy;
+	uint16_t hash;             /*!< position hash, see MatrixHash */
+	uint16_t done;             /*!< enmy moves whose reply is ready */
+	uint16_t reply[MATRIX_3X3_ELEMENT_TOTAL];  /*!< best moves of friend after enmy move n */
+	bool     active;           /*!< pondering is started and not stopped */
+	uint8_t  enmy_move;        /*!< enmy move being pondered, MATRIX_3X3_ELEMENT_TOTAL means none */
+	uint8_t  friend_move;      /*!< reply being searched */
+	uint8_t  hint;             /*!< enmy move to ponder first */
+	int8_t   best;             /*!< best score of searched replies */
+	bool     running;          /*!< search of friend_move is on minmax_stack */
+} T_MINMAX_PONDER;
+
+
+class MinmaxEngine
+{
+public:
+
+/**
+	* @brief  construction, nothing searched and no pondering
+	*/
+	MinmaxEngine();
+
+/**
+	* @brief  forget the scores in cache, for example before a new game
+	*/
+	void flush(void);
+
+/**
+	* @brief calculate the next step of friend
+	* @param MatrixMap_Friend map of friend, friend is the next one to move
+	* @param MatrixMap_Enmy map of enmy
+	* @param hash position hash, see MatrixHash
+	* @param budget_us time limit in microseconds, 0 means no limit
+	* @return next position, MATRIX_3X3_ELEMENT_TOTAL if matrix full
+	* @note  with budget, search goes one ply deeper each round, and stops when budget
+	*        runs out. Best move of the last finished round is taken, positions beyond
+	*        the searched depth are guessed by open lines. The first round is always
+	*        finished, so it may take a little longer than a tiny budget.
+	*/
+	MATRIX_3X3_ELEMENT BestNextMove(T_MATRIX_3X3 MatrixMap_Friend, T_MATRIX_3X3 MatrixMap_Enmy, uint16_t hash, uint32_t budget_us);
+
+/**
+	* @brief score every empty position in one search
+	* @param MatrixMap_Friend map of friend, friend is the next one to move
+	* @param MatrixMap_Enmy map of enmy
+	* @param hash position hash, see MatrixHash
+	* @param scores minmax score of putting friend on each position, in view of friend,
+	*        MINMAX_SCORE_NONE for occupied position
+	* @return mask of best moves(bit n is MATRIX_3X3_ELEMENT n), same choices as BestNextMove
+	* @note  every move is searched with full window, so the scores are exact, not only
+	*        the best one. Symmetric moves share one search, and the cache carries
+	*        positions from one move to the next.
+	*        It stops pondering as BestNextMove does, since both search on minmax_stack,
+	*        so a hint display should not call it while replies are pondered.
+	*/
+	uint16_t ScoreAllMoves(T_MATRIX_3X3 MatrixMap_Friend, T_MATRIX_3X3 MatrixMap_Enmy, uint16_t hash, int8_t scores[MATRIX_3X3_ELEMENT_TOTAL]);
+
+/**
+	* @brief  pick one of the best moves randomly
+	* @param  BestMoves mask of moves
+	* @return move, MATRIX_3X3_ELEMENT_TOTAL if mask is 0
+	*/
+	MATRIX_3X3_ELEMENT pick(uint16_t BestMoves);
+
+/**
+	* @brief start to ponder, search the replies to every move of enmy
+	* @param MatrixMap_Friend map of friend
+	* @param MatrixMap_Enmy map of enmy, enmy is the next one to move
+	* @param hash position hash in view of friend, see MatrixHash
+	* @note  pondered replies are the same as BestNextMove, it reads them instead of
+	*        searching again if enmy made a single move since ponderStart.
+	*/
+	void ponderStart(T_MATRIX_3X3 MatrixMap_Friend, T_MATRIX_3X3 MatrixMap_Enmy, uint16_t hash);
+
+/**
+	* @brief drive pondering work a slice of time
+	* @param MatrixMap_Friend map of friend now
+	* @param MatrixMap_Enmy map of enmy now
+	* @param slice_us time of the slice in microseconds
+	* @note  pondering stops by itself when the position is not the one of ponderStart
+	*/
+	void ponderRoutine(T_MATRIX_3X3 MatrixMap_Friend, T_MATRIX_3X3 MatrixMap_Enmy, uint32_t slice_us);
+
+/**
+	* @brief stop pondering, pondered replies are dropped
+	*/
+	void ponderStop(void);
+
+/**
+	* @brief tell which move enmy is likely to make, it is pondered next
+	* @param element
+	*/
+	void set_PonderHint(MATRIX_3X3_ELEMENT element);
+
+/**
+	* @brief get the pondered replies to one move of enmy
+	* @param element move of enmy
+	* @param *moves mask of best moves of friend after the move, 0 if enmy wins or fills matrix
+	* @retval true reply is ready
+	* @retval false not pondered yet, or pondering is stopped
+	*/
+	bool get_PonderReply(MATRIX_3X3_ELEMENT element, uint16_t *moves);
+
+/**
+	* @brief select the order of moves tried in search, it changes search speed only
+	* @param order
+	* @arg   MINMAX_ORDER_INDEX
+	* @arg   MINMAX_ORDER_HEURISTIC(default)
+	*/
+	void set_MoveOrder(MINMAX_MOVE_ORDER order);
+
+/**
+	* @brief get node and cutoff counter of minmax search
+	* @param *stats
+	* @note  counters keep adding up between BestNextMove calls, until reset_SearchStats
+	*/
+	void get_SearchStats(T_MINMAX_SEARCH_STATS *stats);
+
+/**
+	* @brief clear node and cutoff counter of minmax search
+	*/
+	void reset_SearchStats(void);
+
+/**
+	* @brief get hit, miss and replace counter of minmax cache
+	* @param *stats
+	* @note  counters keep adding up between BestNextMove calls, until reset_CacheStats
+	*/
+	void get_CacheStats(T_MINMAX_CACHE_STATS *stats);
+
+/**
+	* @brief clear hit, miss and replace counter of minmax cache
+	*/
+	void reset_CacheStats(void);
+
+#if MINMAX_MOVE_STATS
+/**
+	* @brief get the cost of the last BestNextMove or ScoreAllMoves
+	* @param *stats
+	* @note  only with MINMAX_MOVE_STATS set to 1, elapsed time includes pick and
+	*        symmetry work around the search
+	*/
+	void get_MoveStats(T_MINMAX_MOVE_STATS *stats);
+#endif
+
+/**
+	* @brief get SRAM bytes of minmax search stack
+	* @return bytes, the worst case of any search, not more than MINMAX_STACK_BUDGET
+	*/
+	static uint16_t get_SearchStackSize(void);
+
+private:
+
+#if MINMAX_MOVE_STATS
+/**
+	* @brief  take counters at the start of a search
+	*/
+	void _move_stats_begin(void);
+
+/**
+	* @brief  turn counters taken by _move_stats_begin into the cost of the search
+	*/
+	void _move_stats_end(void);
+#endif
+
+/**
+	* @brief  calculate minmax score
+	* @param  MatrixMap_Own
+	* @param  MatrixMap_Other	
+	* @return minmax score in view of MatrixMap_Own
+	*/	
+	int8_t _minmax_cal_score(T_MATRIX_3X3 MatrixMap_Own, T_MATRIX_3X3 MatrixMap_Other);
+
+/**
+	* @brief  guess score of position at search horizon
+	* @param  MatrixMap_Own
+	* @param  MatrixMap_Other
+	* @return open lines of own minus open lines of other, less than one line score
+	*/
+	int8_t _minmax_evaluate(T_MATRIX_3X3 MatrixMap_Own, T_MATRIX_3X3 MatrixMap_Other);
+
+/**
+	* @brief  find the empty elements which make a bingo line
+	* @param  MatrixMap map of the one to move
+	* @param  empty mask of empty elements
+	* @return mask of elements which win at once
+	*/
+	uint16_t _minmax_threat(T_MATRIX_3X3 MatrixMap, uint16_t empty);
+
+/**
+	* @brief  pick the next move to search and remove it from the remaining moves
+	* @param  *frame position being searched, remaining moves must not be 0
+	* @return move to search
+	*/
+	MATRIX_3X3_ELEMENT _minmax_next_move(T_MINMAX_FRAME *frame);
+
+/**
+	* @brief  remember the move which caused a cutoff
+	* @param  move
+	* @param  ply number of pieces on matrix
+	*/
+	void _minmax_record_cutoff(MATRIX_3X3_ELEMENT move, uint8_t ply);
+
+/**
+	* @brief according to current friend and enmy status, calculate the next step  
+	* @param MatrixMap_Friend map of friend
+	* @param MatrixMap_Enmy map of enmy
+	* @param hash position hash, see MatrixHash
+	* @param WhoseTurn next step of friend or enmy		 	
+	* @param budget_us time limit in microseconds, 0 means search to the end of game
+	* @return next position	
+	*/
+	MATRIX_3X3_ELEMENT _BestNextMove_Wrapper(T_MATRIX_3X3 MatrixMap_Friend, T_MATRIX_3X3 MatrixMap_Enmy, uint16_t hash, PLAYER_TYPE WhoseTurn, uint32_t budget_us);
+
+/**
+	* @brief search all the moves of current position until minmax_horizon
+	* @param MatrixMap_Own map of the one to move
+	* @param MatrixMap_Other map of the other one
+	* @param hash position hash, see MatrixHash
+	* @param WhoseTurn the one to move is friend or enmy
+	* @return mask of best moves, not valid if minmax_abort is set
+	*/
+	uint16_t _minmax_root(T_MATRIX_3X3 MatrixMap_Own, T_MATRIX_3X3 MatrixMap_Other, uint16_t hash, PLAYER_TYPE WhoseTurn);
+
+/**
+	* @brief find the smallest element which is symmetric to the specify element
+	* @param element
+	* @param SymmetryMask symmetries keep the position unchanged, see MatrixSymmetry::stabilizer
+	* @return smallest symmetric element, element itself if no smaller one
+	*/
+	MATRIX_3X3_ELEMENT _symmetric_element(MATRIX_3X3_ELEMENT element, uint8_t SymmetryMask);
+
+/**
+	* @brief  set up the frame of a position, score it at once if game over or cached
+	* @param  *frame
+	* @param  map_own map of the one to move
+	* @param  map_other map of the other one
+	* @param  hash position hash, see MatrixHash
+	* @param  alpha_score in view of the one to move, as beta_score
+	* @param  beta_score
+	* @param  WhoseTurn the one to move is friend or enmy
+	* @note   frame without remaining moves is done, its score is frame->best
+	*/
+	void _minmax_enter(T_MINMAX_FRAME *frame, uint16_t map_own, uint16_t map_other, uint16_t hash, int8_t alpha_score, int8_t beta_score, PLAYER_TYPE WhoseTurn);
+
+/**
+	* @brief  set up minmax_stack to search a position, _minmax_resume does the work
+	* @param  MatrixMap_Own map of the one to move
+	* @param  MatrixMap_Other map of the other one
+	* @param  hash position hash, see MatrixHash
+	* @param  alpha_score in view of the one to move, as beta_score
+	* @param  beta_score
+	* @param  WhoseTurn the one to move is friend or enmy
+	*/
+	void _minmax_begin(T_MATRIX_3X3 MatrixMap_Own, T_MATRIX_3X3 MatrixMap_Other, uint16_t hash, int8_t alpha_score, int8_t beta_score, PLAYER_TYPE WhoseTurn);
+
+/**
+	* @brief  continue the search on minmax_stack until done or minmax_abort
+	* @param  *score score of the position in _minmax_begin when done, in view of the one to move
+	* @retval true done
+	* @retval false out of time, call again to continue
+	*/
+	bool _minmax_resume(int8_t *score);
+
+/**
+	* @brief  take the pondered reply and stop pondering
+	* @param  MatrixMap_Friend map of friend, friend is the next one to move
+	* @param  MatrixMap_Enmy map of enmy
+	* @return mask of best moves, 0 means not pondered
+	*/
+	uint16_t _ponder_read(T_MATRIX_3X3 MatrixMap_Friend, T_MATRIX_3X3 MatrixMap_Enmy);
+
+/**
+	* @brief negamax score of a position
+	* @param MatrixMap_Own map of the one to move
+	* @param MatrixMap_Other map of the other one
+	* @param hash position hash, see MatrixHash
+	* @param alpha_score in view of the one to move, as beta_score
+	* @param beta_score
+	* @param WhoseTurn the one to move is friend or enmy
+	* @return score in view of the one to move, the parent takes it negated
+	* @note  search runs on minmax_stack instead of recursion, so stack usage is fixed
+	*/
+	int8_t _minmax(T_MATRIX_3X3 MatrixMap_Own, T_MATRIX_3X3 MatrixMap_Other, uint16_t hash, int8_t alpha_score, int8_t beta_score, PLAYER_TYPE WhoseTurn);
+
+	/** scores of searched positions */
+	MinmaxCache minmax_cache;
+
+	/** order of moves tried in search */
+	MINMAX_MOVE_ORDER minmax_move_order;
+
+	/** killer move of each ply, MATRIX_3X3_ELEMENT_TOTAL means none */
+	uint8_t minmax_killer[MATRIX_3X3_ELEMENT_TOTAL + 1];
+
+	/** how often each move caused a cutoff, halved on every BestNextMove */
+	uint8_t minmax_history[MATRIX_3X3_ELEMENT_TOTAL];
+
+	/** node and cutoff counter */
+	T_MINMAX_SEARCH_STATS minmax_stats;
+
+#if MINMAX_MOVE_STATS
+	/** cost of the last search */
+	T_MINMAX_MOVE_STATS minmax_move_stats;
+
+	/** deepest frame since _move_stats_begin, pondering moves it but not the last cost */
+	uint8_t minmax_depth_max;
+#endif
+
+	/** frames of minmax search, index is depth from the searched position */
+	T_MINMAX_FRAME minmax_stack[MINMAX_STACK_DEPTH];
+
+	/** frame where the search continues */
+	T_MINMAX_FRAME *minmax_frame;
+
+	/** positions with this number of pieces are guessed instead of searched */
+	uint8_t minmax_horizon;
+
+	/** search is out of time, result is not valid */
+	bool minmax_abort;
+
+	/** time limit of search, 0 means no limit */
+	uint32_t minmax_budget_us;
+
+	/** micros() when search started */
+	uint32_t minmax_start_us;
+
+	/** pondering state and replies */
+	T_MINMAX_PONDER ponder;
+};
+
+#endif  //EE33_MINMAX_H
+
+
+/*
+ * @release note
+ * | v1.0 2026-10-16 - 3lectron3ats : Initial Release
+ * #
+*/
@@ -0,0 +1,89 @@
+/**
+  * @file      EE33_MinmaxCache.cpp
+  * @version   v1.0
+  * @author    3lectron3ats <3lectron3ats@gmail.com>
+  * @date      2026.10.16
+  * @brief     Fixed size transposition cache of minmax search.
+  * @copyright GPL v3.0
+  * *************************************************************************************
+  * @attention
+  * <h2><center>&copy; COPYRIGHT 2023 3lectron3ats </center></h2>
+  * *************************************************************************************
+  */
+
+#include <EE33_Tic_Tac_Toe.h>
+#include <EE33_MinmaxCache.h>
+
+MinmaxCache::MinmaxCache()
+{
+	flush();
+	reset_Stats();
+}
+
+void MinmaxCache::flush(void)
+{
+	memset(entry, 0, sizeof(entry));
+}
+
+uint32_t MinmaxCache::key(T_MATRIX_3X3 MatrixMap_Friend, T_MATRIX_3X3 MatrixMap_Enmy, PLAYER_TYPE WhoseTurn)
+{
+	return ((uint32_t)WhoseTurn << (2 * MATRIX_3X3_ELEMENT_TOTAL)) | ((uint32_t)MatrixMap_Friend.d16 << MATRIX_3X3_ELEMENT_TOTAL) | MatrixMap_Enmy.d16;
+}
+
+bool MinmaxCache::probe(uint32_t key, uint16_t hash, uint8_t draft, int8_t *score, MINMAX_BOUND *bound)
+{
+	T_MINMAX_CACHE_ENTRY *p_entry = &entry[_slot(hash)];
+
+	if (p_entry->valid && p_entry->key_low == (uint16_t)key && p_entry->key_high == (uint8_t)(key >> 16) && p_entry->draft >= draft)
+	{
+		*score = p_entry->score;
+		*bound = (MINMAX_BOUND)p_entry->bound;
+
+		stats.hit++;
+
+		return true;
+	}
+
+	stats.miss++;
+
+	return false;
+}
+
+void MinmaxCache::store(uint32_t key, uint16_t hash, uint8_t draft, int8_t score, MINMAX_BOUND bound)
+{
+	T_MINMAX_CACHE_ENTRY *p_entry = &entry[_slot(hash)];
+
+	if (p_entry->valid && (p_entry->key_low != (uint16_t)key || p_entry->key_high != (uint8_t)(key >> 16)))
+	{
+		stats.replace++;
+	}
+
+	p_entry->key_low = (uint16_t)key;
+	p_entry->key_high = (uint8_t)(key >> 16);
+	p_entry->bound = bound;
+	p_entry->valid = 1;
+	p_entry->score = score;
+	p_entry->draft = draft;
+}
+
+void MinmaxCache::get_Stats(T_MINMAX_CACHE_STATS *stats)
+{
+	*stats = this->stats;
+}
+
+void MinmaxCache::reset_Stats(void)
+{
+	memset(&stats, 0, sizeof(stats));
+}
+
+uint8_t MinmaxCache::_slot(uint16_t hash)
+{
+	return hash & (((MINMAX_CACHE_SIZE) ? MINMAX_CACHE_SIZE : 1) - 1);
+}
+
+
+/*
+ * @release note
+ * | v1.0 2026-10-16 - 3lectron3ats : Initial Release
+ * #
+*/
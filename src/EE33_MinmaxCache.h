@@ -0,0 +1,151 @@
+/**
+  * @file      EE33_MinmaxCache.h
+  * @version   v1.0
+  * @author    3lectron3ats <3lectron3ats@gmail.com>
+  * @date      2026.10.16
+  * @brief     Fixed size transposition cache of minmax search.
+  * @copyright GPL v3.0
+  * *************************************************************************************
+  * @attention
+  * <h2><center>&copy; COPYRIGHT 2023 3lectron3ats </center></h2>
+  * *************************************************************************************
+  * @note
+  *   Key is the position plus whose turn, 19 bits, and the full key is kept in entry,
+  *   so a hit is never a false one. Entry is picked by the position hash(see
+  *   MatrixHash), which search updates move by move, so no key work is done per
+  *   lookup. Symmetric positions are different keys. Score is in view of the one to
+  *   move, and the turn bit of the key keeps the same maps with friend to move apart
+  *   from them with enmy to move, so entries stay valid between BestNextMove calls.
+  *   Draft is how many plies were searched below the position, a search limited by
+  *   depth only takes entries searched at least as deep as it needs.
+  *   Each entry takes 5 bytes SRAM, set MINMAX_CACHE_SIZE to 0 to remove the cache,
+  *   for the whole build, see EE33_MinmaxConfig.h.
+  */
+
+
+#ifndef EE33_MINMAX_CACHE_H
+#define EE33_MINMAX_CACHE_H
+
+// Arduino versioning.
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "Arduino.h"	// for digitalRead, digitalWrite, etc
+#else
+#include "WProgram.h"
+#endif
+
+#include <EE33_Matrix.h>
+#include <EE33_MinmaxConfig.h>
+
+#define MINMAX_CACHE_VERSION_MAJOR  1
+#define MINMAX_CACHE_VERSION_MINOR  0
+
+#if (MINMAX_CACHE_SIZE & (MINMAX_CACHE_SIZE - 1)) || (MINMAX_CACHE_SIZE > 256)
+#error "MINMAX_CACHE_SIZE must be power of 2, and not more than 256"
+#endif
+
+/*! what the cached score means, the alpha-beta window decides it */
+typedef enum
+{
+	MINMAX_BOUND_EXACT = 0,  /*!< score is the real score */
+	MINMAX_BOUND_LOWER,      /*!< real score >= score, search was cut by beta */
+	MINMAX_BOUND_UPPER,      /*!< real score <= score, no move reached alpha */
+} MINMAX_BOUND;
+
+typedef struct
+{
+	uint16_t key_low;         /*!< key bit 0 ~ 15 */
+	uint8_t  key_high : 3;    /*!< key bit 16 ~ 18 */
+	uint8_t  bound    : 2;    /*!< MINMAX_BOUND */
+	uint8_t  valid    : 1;
+	uint8_t  rsv      : 2;
+	int8_t   score;
+	uint8_t  draft;           /*!< plies searched below the position */
+} T_MINMAX_CACHE_ENTRY;
+
+typedef struct
+{
+	uint32_t hit;             /*!< probe found the position */
+	uint32_t miss;            /*!< probe did not find the position */
+	uint32_t replace;         /*!< store overwrote another position */
+} T_MINMAX_CACHE_STATS;
+
+class MinmaxCache
+{
+public:
+
+/**
+	* @brief  construction, cache is empty
+	*/
+	MinmaxCache();
+
+/**
+	* @brief  remove all entries, statistics are kept
+	*/
+	void flush(void);
+
+/**
+	* @brief  encode position as cache key
+	* @param  MatrixMap_Friend map of the one to move
+	* @param  MatrixMap_Enmy map of the other one
+	* @param  WhoseTurn the one to move is friend or enmy
+	* @return key
+	*/
+	static uint32_t key(T_MATRIX_3X3 MatrixMap_Friend, T_MATRIX_3X3 MatrixMap_Enmy, PLAYER_TYPE WhoseTurn);
+
+/**
+	* @brief  look up position
+	* @param  key return value of key()
+	* @param  hash position hash, see MatrixHash
+	* @param  draft plies the caller needs, shallower entry is not taken
+	* @param  *score cached score, in view of the one to move
+	* @param  *bound meaning of cached score
+	* @retval true position found
+	* @retval false position not found or not deep enough
+	*/
+	bool probe(uint32_t key, uint16_t hash, uint8_t draft, int8_t *score, MINMAX_BOUND *bound);
+
+/**
+	* @brief  save position, the old position in the same entry is replaced
+	* @param  key return value of key()
+	* @param  hash position hash, see MatrixHash
+	* @param  draft plies searched below the position
+	* @param  score in view of the one to move
+	* @param  bound
+	*/
+	void store(uint32_t key, uint16_t hash, uint8_t draft, int8_t score, MINMAX_BOUND bound);
+
+/**
+	* @brief  get hit, miss and replace counter
+	* @param  *stats
+	*/
+	void get_Stats(T_MINMAX_CACHE_STATS *stats);
+
+/**
+	* @brief  clear hit, miss and replace counter
+	*/
+	void reset_Stats(void);
+
+private:
+
+/**
+	* @brief  entry which the position belongs to
+	* @param  hash position hash
+	* @return entry index
+	*/
+	uint8_t _slot(uint16_t hash);
+
+	/** cache entries */
+	T_MINMAX_CACHE_ENTRY entry[(MINMAX_CACHE_SIZE) ? MINMAX_CACHE_SIZE : 1];
+
+	/** hit, miss and replace counter */
+	T_MINMAX_CACHE_STATS stats;
+};
+
+#endif  //EE33_MINMAX_CACHE_H
+
+
+/*
+ * @release note
+ * | v1.0 2026-10-16 - 3lectron3ats : Initial Release
+ * #
+*/
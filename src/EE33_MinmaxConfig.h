@@ -0,0 +1,49 @@
+/**
+  * @file      EE33_MinmaxConfig.h
+  * @version   v1.0
+  * @author    3lectron3ats <3lectron3ats@gmail.com>
+  * @date      2026.10.16
+  * @brief     Build settings of the minmax engine, in one place.
+  * @copyright GPL v3.0
+  * *************************************************************************************
+  * @attention
+  * <h2><center>&copy; COPYRIGHT 2023 3lectron3ats </center></h2>
+  * *************************************************************************************
+  * @note
+  *   MINMAX_CACHE_SIZE and MINMAX_MOVE_STATS change the members of MinmaxEngine, so the
+  *   sketch and the library .cpp files must be built with the same values. Set them
+  *   for the whole build: edit the defaults here, or pass -D on every compile, for
+  *   example by compiler.cpp.extra_flags in platform.local.txt, or
+  *       arduino-cli compile --build-property "compiler.cpp.extra_flags=-DMINMAX_CACHE_SIZE=64"
+  *   A #define in the sketch before #include does NOT reach the library .cpp files,
+  *   the two then see different MinmaxEngine layouts and corrupt memory.
+  *   MINMAX_STACK_BUDGET only sets a compile-time check, it is kept here with them.
+  */
+
+
+#ifndef EE33_MINMAX_CONFIG_H
+#define EE33_MINMAX_CONFIG_H
+
+/** number of cache entries, must be power of 2, 0 means no cache */
+#ifndef MINMAX_CACHE_SIZE
+#define MINMAX_CACHE_SIZE        32
+#endif
+
+/** 1 keeps T_MINMAX_MOVE_STATS of the last search, 0 takes its counters and code out */
+#ifndef MINMAX_MOVE_STATS
+#define MINMAX_MOVE_STATS        0
+#endif
+
+/** SRAM bytes allowed for the search stack, checked at compile time */
+#ifndef MINMAX_STACK_BUDGET
+#define MINMAX_STACK_BUDGET      128
+#endif
+
+#endif  //EE33_MINMAX_CONFIG_H
+
+
+/*
+ * @release note
+ * | v1.0 2026-10-16 - 3lectron3ats : Initial Release
+ * #
+*/
@@ -0,0 +1,123 @@
+/**
+  * @file      EE33_MoveTable.cpp
+  * @version   v1.0
+  * @author    3lectron3ats <3lectron3ats@gmail.com>
+  * @date      2026.10.16
+  * @brief     Perfect-play move table of Tic-Tac-Toe stored in flash.
+  * @copyright GPL v3.0
+  * *************************************************************************************
+  * @attention
+  * <h2><center>&copy; COPYRIGHT 2023 3lectron3ats </center></h2>
+  * *************************************************************************************
+  */
+
+#include <EE33_Tic_Tac_Toe.h>
+#include <EE33_MoveTable.h>
+#include <EE33_Symmetry.h>
+#include <EE33_MoveTable_data.h>
+
+/** binomial coefficient C(n, k), n and k are 0 ~ 9 */
+const uint8_t binomial_table[MATRIX_3X3_ELEMENT_TOTAL + 1][MATRIX_3X3_ELEMENT_TOTAL + 1] PROGMEM =
+{
+	{1,   0,   0,   0,   0,   0,   0,   0,   0,   0},
+	{1,   1,   0,   0,   0,   0,   0,   0,   0,   0},
+	{1,   2,   1,   0,   0,   0,   0,   0,   0,   0},
+	{1,   3,   3,   1,   0,   0,   0,   0,   0,   0},
+	{1,   4,   6,   4,   1,   0,   0,   0,   0,   0},
+	{1,   5,  10,  10,   5,   1,   0,   0,   0,   0},
+	{1,   6,  15,  20,  15,   6,   1,   0,   0,   0},
+	{1,   7,  21,  35,  35,  21,   7,   1,   0,   0},
+	{1,   8,  28,  56,  70,  56,  28,   8,   1,   0},
+	{1,   9,  36,  84, 126, 126,  84,  36,   9,   1},
+};
+
+/** first table index of positions with n pieces on matrix */
+const uint16_t move_table_offset[MATRIX_3X3_ELEMENT_TOTAL + 1] PROGMEM =
+{
+	0, 1, 10, 82, 334, 1090, 2350, 4030, 5290, 5920,
+};
+
+#define BINOMIAL(n, k)  pgm_read_byte(&binomial_table[n][k])
+
+uint16_t MoveTable::index(T_MATRIX_3X3 MatrixMap_Friend, T_MATRIX_3X3 MatrixMap_Enmy)
+{
+	uint8_t index;
+	uint8_t occupy_number = 0, friend_number = 0;
+	uint8_t occupy_rank = 0, friend_rank = 0;
+
+	if (MatrixMap_Friend.d16 & MatrixMap_Enmy.d16)
+	{
+		return MOVE_TABLE_INVALID;  //one LED can not be both friend and enmy
+	}
+
+	//colex rank of occupied cells, and colex rank of friend cells among the occupied cells
+	for (index = MATRIX_3X3_M11; index < MATRIX_3X3_ELEMENT_TOTAL; index++)
+	{
+		if ((MatrixMap_Friend.d16 | MatrixMap_Enmy.d16) & bit(index))
+		{
+			occupy_number++;
+			occupy_rank += BINOMIAL(index, occupy_number);
+
+			if (MatrixMap_Friend.d16 & bit(index))
+			{
+				friend_number++;
+				friend_rank += BINOMIAL(occupy_number - 1, friend_number);
+			}
+		}
+	}
+
+	if (friend_number != occupy_number / 2)
+	{
+		return MOVE_TABLE_INVALID;  //not friend's turn
+	}
+
+	return pgm_read_word(&move_table_offset[occupy_number]) + (uint16_t)occupy_rank * BINOMIAL(occupy_number, friend_number) + friend_rank;
+}
+
+uint16_t MoveTable::read(T_MATRIX_3X3 MatrixMap_Friend, T_MATRIX_3X3 MatrixMap_Enmy)
+{
+	MATRIX_SYMMETRY symmetry;
+	uint16_t key;
+	int16_t low = 0, high = MOVE_TABLE_SIZE - 1;
+
+	symmetry = MatrixSymmetry::canonical(&MatrixMap_Friend, &MatrixMap_Enmy);
+	key = index(MatrixMap_Friend, MatrixMap_Enmy);
+
+	if (key == MOVE_TABLE_INVALID)
+	{
+		return MOVE_TABLE_INVALID;
+	}
+
+	while (low <= high)
+	{
+		int16_t middle = (low + high) / 2;
+		uint16_t middle_key = pgm_read_word(&move_table_key[middle]);
+
+		if (middle_key == key)
+		{
+			T_MATRIX_3X3 moves;
+
+			moves.d16 = pgm_read_word(&move_table[middle]);
+
+			return MatrixSymmetry::restore(moves, symmetry).d16;
+		}
+
+		if (middle_key < key)
+		{
+			low = middle + 1;
+		}
+		else
+		{
+			high = middle - 1;
+		}
+	}
+
+	return MOVE_TABLE_INVALID;
+}
+
+
+/*
+ * @release note
+ * | v1.0 2026-10-16 - 3lectron3ats : Initial Release
+ * #
+*/
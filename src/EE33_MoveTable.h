@@ -0,0 +1,69 @@
+/**
+  * @file      EE33_MoveTable.h
+  * @version   v1.0
+  * @author    3lectron3ats <3lectron3ats@gmail.com>
+  * @date      2026.10.16
+  * @brief     Perfect-play move table of Tic-Tac-Toe stored in flash.
+  * @copyright GPL v3.0
+  * *************************************************************************************
+  * @attention
+  * <h2><center>&copy; COPYRIGHT 2023 3lectron3ats </center></h2>
+  * *************************************************************************************
+  * @note
+  *   Positions with the friend to move (friend has as many pieces as the enmy, or one
+  *   less) are numbered by index(), 6046 in total. Only the 850 canonical ones are
+  *   stored(see EE33_Symmetry.h), each with the 9-bit mask of all the moves which get
+  *   the best minmax score, so caller can still pick one randomly.
+  *   Table data is generated by extras/tools/move_table_gen.cpp.
+  */
+
+
+#ifndef EE33_MOVE_TABLE_H
+#define EE33_MOVE_TABLE_H
+
+// Arduino versioning.
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "Arduino.h"	// for digitalRead, digitalWrite, etc
+#else
+#include "WProgram.h"
+#endif
+
+#include <EE33_Matrix.h>
+
+#define MOVE_TABLE_VERSION_MAJOR  1
+#define MOVE_TABLE_VERSION_MINOR  0
+
+#define MOVE_TABLE_INDEX_TOTAL    6046
+#define MOVE_TABLE_SIZE           850
+#define MOVE_TABLE_INVALID        0xFFFF
+
+class MoveTable
+{
+public:
+
+/**
+	* @brief  calculate the index of position
+	* @param  MatrixMap_Friend map of friend, friend is the next one to move
+	* @param  MatrixMap_Enmy map of enmy
+	* @return 0 ~ MOVE_TABLE_INDEX_TOTAL - 1, MOVE_TABLE_INVALID means not friend's turn
+	*/
+	static uint16_t index(T_MATRIX_3X3 MatrixMap_Friend, T_MATRIX_3X3 MatrixMap_Enmy);
+
+/**
+	* @brief  read the best moves of position
+	* @param  MatrixMap_Friend map of friend, friend is the next one to move
+	* @param  MatrixMap_Enmy map of enmy
+	* @return mask of best moves(bit n is MATRIX_3X3_ELEMENT n), 0 means matrix full,
+	*         MOVE_TABLE_INVALID means position is not in table
+	*/
+	static uint16_t read(T_MATRIX_3X3 MatrixMap_Friend, T_MATRIX_3X3 MatrixMap_Enmy);
+};
+
+#endif  //EE33_MOVE_TABLE_H
+
+
+/*
+ * @release note
+ * | v1.0 2026-10-16 - 3lectron3ats : Initial Release
+ * #
+*/
@@ -0,0 +1,166 @@
+/**
+  * @file      EE33_MoveTable_data.h
+  * @brief     Generated by extras/tools/move_table_gen.cpp, do not edit.
+  * @copyright GPL v3.0
+  */
+
+#ifndef EE33_MOVE_TABLE_DATA_H
+#define EE33_MOVE_TABLE_DATA_H
+
+#if MOVE_TABLE_SIZE != 850
+#error "MOVE_TABLE_SIZE does not match the generated table"
+#endif
+
+/** MoveTable::index() of canonical positions, ascending */
+const uint16_t move_table_key[MOVE_TABLE_SIZE] PROGMEM =
+{
+	   0,    1,    2,    5,   10,   11,   12,   18,   22,   23,   24,   25,
+	  30,   42,   54,   66,   82,   83,   85,   86,   88,   91,   94,   95,
+	  96,   97,   99,  106,  108,  111,  112,  115,  121,  124,  130,  140,
+	 143,  145,  148,  154,  163,  167,  172,  175,  188,  199,  208,  217,
+	 235,  250,  253,  268,  280,  298,  334,  335,  338,  339,  340,  341,
+	 343,  344,  346,  348,  349,  350,  352,  354,  355,  359,  360,  361,
+	 364,  370,  372,  375,  376,  378,  381,  383,  384,  388,  389,  395,
+	 407,  410,  412,  413,  416,  418,  424,  425,  429,  430,  436,  438,
+	 443,  444,  446,  448,  450,  454,  455,  458,  461,  464,  473,  478,
+	 484,  490,  494,  500,  504,  508,  510,  514,  516,  517,  520,  526,
+	 544,  545,  550,  556,  558,  564,  568,  570,  574,  593,  598,  604,
+	 628,  630,  634,  640,  664,  670,  694,  706,  754,  760,  762,  768,
+	 773,  774,  778,  779,  785,  802,  808,  814,  838,  844,  850,  874,
+	 880,  882,  904,  916,  964,  994, 1090, 1091, 1094, 1095, 1096, 1097,
+	1100, 1101, 1104, 1105, 1109, 1110, 1113, 1120, 1122, 1123, 1124, 1128,
+	1130, 1132, 1133, 1138, 1141, 1142, 1150, 1151, 1154, 1155, 1158, 1160,
+	1161, 1163, 1164, 1168, 1170, 1174, 1180, 1182, 1191, 1192, 1193, 1197,
+	1200, 1201, 1208, 1210, 1212, 1215, 1220, 1222, 1225, 1227, 1231, 1232,
+	1235, 1237, 1240, 1241, 1242, 1250, 1251, 1257, 1261, 1267, 1271, 1274,
+	1280, 1281, 1284, 1290, 1294, 1296, 1300, 1301, 1305, 1310, 1311, 1314,
+	1320, 1324, 1330, 1332, 1342, 1343, 1350, 1360, 1362, 1365, 1370, 1372,
+	1375, 1381, 1382, 1390, 1391, 1401, 1430, 1431, 1434, 1440, 1450, 1451,
+	1460, 1470, 1472, 1482, 1490, 1492, 1500, 1511, 1531, 1540, 1550, 1560,
+	1564, 1600, 1620, 1650, 1654, 1655, 1660, 1663, 1670, 1672, 1673, 1682,
+	1683, 1691, 1692, 1700, 1710, 1712, 1722, 1731, 1732, 1740, 1741, 1751,
+	1771, 1780, 1790, 1800, 1801, 1805, 1810, 1820, 1822, 1831, 1832, 1840,
+	1842, 1850, 1851, 1854, 1881, 1890, 1900, 1940, 1950, 1960, 2000, 2010,
+	2022, 2032, 2040, 2090, 2100, 2140, 2150, 2160, 2200, 2210, 2250, 2270,
+	2350, 2351, 2352, 2353, 2354, 2355, 2358, 2359, 2363, 2364, 2369, 2370,
+	2371, 2372, 2373, 2374, 2375, 2378, 2379, 2381, 2382, 2388, 2390, 2391,
+	2392, 2393, 2397, 2398, 2401, 2402, 2406, 2407, 2410, 2411, 2412, 2421,
+	2422, 2425, 2426, 2427, 2430, 2431, 2433, 2435, 2436, 2439, 2446, 2447,
+	2450, 2451, 2453, 2455, 2459, 2460, 2464, 2466, 2470, 2472, 2473, 2475,
+	2479, 2480, 2484, 2486, 2490, 2492, 2493, 2494, 2495, 2499, 2510, 2511,
+	2512, 2513, 2517, 2518, 2531, 2550, 2551, 2553, 2555, 2556, 2559, 2570,
+	2571, 2573, 2575, 2579, 2590, 2592, 2593, 2610, 2612, 2613, 2616, 2630,
+	2631, 2632, 2636, 2651, 2670, 2671, 2673, 2690, 2693, 2694, 2710, 2715,
+	2716, 2717, 2718, 2732, 2733, 2737, 2738, 2750, 2752, 2757, 2770, 2772,
+	2774, 2777, 2790, 2797, 2798, 2810, 2814, 2816, 2817, 2834, 2851, 2871,
+	2877, 2890, 2911, 2912, 2913, 2914, 2918, 2919, 2931, 2932, 2933, 2937,
+	2951, 2970, 2971, 2973, 2975, 2990, 2993, 2995, 3010, 3012, 3013, 3030,
+	3031, 3032, 3033, 3035, 3036, 3050, 3051, 3052, 3055, 3056, 3059, 3071,
+	3090, 3091, 3093, 3110, 3112, 3113, 3114, 3135, 3136, 3137, 3138, 3150,
+	3152, 3153, 3158, 3170, 3172, 3174, 3177, 3190, 3194, 3210, 3218, 3234,
+	3237, 3254, 3271, 3290, 3291, 3310, 3332, 3333, 3351, 3371, 3390, 3393,
+	3410, 3413, 3450, 3452, 3470, 3472, 3490, 3510, 3571, 3590, 3610, 3630,
+	3633, 3670, 3690, 3691, 3710, 3730, 3751, 3810, 3851, 3871, 3890, 3910,
+	4030, 4031, 4032, 4033, 4034, 4035, 4038, 4039, 4043, 4044, 4049, 4051,
+	4052, 4058, 4060, 4061, 4065, 4066, 4067, 4068, 4069, 4070, 4073, 4074,
+	4078, 4079, 4084, 4100, 4102, 4103, 4104, 4105, 4109, 4112, 4135, 4136,
+	4137, 4138, 4142, 4143, 4146, 4147, 4151, 4152, 4170, 4171, 4172, 4181,
+	4182, 4185, 4186, 4187, 4206, 4210, 4211, 4214, 4221, 4222, 4240, 4241,
+	4243, 4245, 4249, 4256, 4275, 4277, 4278, 4280, 4284, 4285, 4289, 4291,
+	4311, 4312, 4313, 4314, 4318, 4319, 4323, 4345, 4346, 4347, 4348, 4349,
+	4350, 4353, 4354, 4356, 4357, 4363, 4380, 4381, 4382, 4383, 4387, 4388,
+	4391, 4392, 4396, 4397, 4416, 4426, 4427, 4430, 4431, 4432, 4450, 4451,
+	4453, 4455, 4456, 4467, 4485, 4486, 4488, 4490, 4494, 4495, 4499, 4501,
+	4520, 4522, 4523, 4530, 4557, 4558, 4559, 4564, 4591, 4592, 4593, 4597,
+	4626, 4660, 4661, 4663, 4665, 4695, 4698, 4700, 4730, 4732, 4733, 4765,
+	4767, 4768, 4771, 4800, 4801, 4802, 4806, 4836, 4870, 4871, 4873, 4905,
+	4908, 4909, 4945, 4946, 4947, 4977, 4978, 4983, 5010, 5012, 5045, 5049,
+	5080, 5119, 5154, 5186, 5221, 5255, 5290, 5291, 5292, 5293, 5294, 5296,
+	5297, 5302, 5303, 5305, 5308, 5310, 5311, 5315, 5316, 5317, 5318, 5319,
+	5320, 5321, 5322, 5339, 5360, 5361, 5362, 5363, 5364, 5366, 5367, 5372,
+	5373, 5375, 5378, 5380, 5381, 5385, 5386, 5387, 5388, 5389, 5390, 5391,
+	5392, 5416, 5430, 5432, 5433, 5434, 5436, 5442, 5500, 5501, 5503, 5504,
+	5505, 5511, 5570, 5572, 5573, 5575, 5578, 5579, 5580, 5581, 5582, 5583,
+	5584, 5593, 5616, 5645, 5647, 5648, 5649, 5650, 5652, 5711, 5713, 5714,
+	5719, 5721, 5723, 5780, 5781, 5783, 5789, 5850, 5855, 5856, 5860, 5920,
+	5921, 5922, 5923, 5924, 5926, 5927, 5932, 5933, 5935, 5938, 5940, 5941,
+	5945, 5946, 5947, 5948, 5949, 5950, 5951, 5952, 5969, 6011,
+};
+
+/** mask of best moves of canonical positions */
+const uint16_t move_table[MOVE_TABLE_SIZE] PROGMEM =
+{
+	0x1FF, 0x010, 0x095, 0x145, 0x058, 0x158, 0x148, 0x011, 0x1EE, 0x1EE, 0x16D, 0x16D,
+	0x054, 0x001, 0x17D, 0x044, 0x048, 0x010, 0x0B0, 0x1F4, 0x030, 0x010, 0x080, 0x1EC,
+	0x004, 0x040, 0x002, 0x1E5, 0x045, 0x0C3, 0x040, 0x1DA, 0x010, 0x010, 0x008, 0x1C7,
+	0x1BC, 0x1BA, 0x010, 0x001, 0x1AD, 0x0AA, 0x004, 0x010, 0x140, 0x140, 0x145, 0x044,
+	0x100, 0x0D0, 0x0FA, 0x044, 0x004, 0x0BD, 0x010, 0x110, 0x010, 0x1B0, 0x040, 0x080,
+	0x168, 0x0A8, 0x004, 0x100, 0x144, 0x0C0, 0x022, 0x100, 0x182, 0x040, 0x080, 0x181,
+	0x1D8, 0x014, 0x194, 0x014, 0x012, 0x1D2, 0x010, 0x100, 0x040, 0x00C, 0x14C, 0x100,
+	0x1C6, 0x1C6, 0x001, 0x1C5, 0x1C5, 0x001, 0x010, 0x100, 0x1B0, 0x1B4, 0x1B2, 0x020,
+	0x010, 0x020, 0x1B0, 0x004, 0x088, 0x122, 0x1AA, 0x100, 0x1A9, 0x080, 0x081, 0x183,
+	0x194, 0x112, 0x190, 0x199, 0x114, 0x194, 0x114, 0x193, 0x010, 0x010, 0x186, 0x185,
+	0x140, 0x010, 0x114, 0x172, 0x030, 0x010, 0x04C, 0x168, 0x002, 0x005, 0x002, 0x15C,
+	0x001, 0x010, 0x041, 0x14E, 0x104, 0x102, 0x100, 0x100, 0x0F8, 0x094, 0x010, 0x010,
+	0x0F1, 0x050, 0x04C, 0x048, 0x020, 0x001, 0x001, 0x004, 0x004, 0x0C3, 0x004, 0x084,
+	0x002, 0x010, 0x080, 0x080, 0x044, 0x040, 0x1E0, 0x1E0, 0x1E0, 0x1E0, 0x100, 0x080,
+	0x1D0, 0x010, 0x100, 0x190, 0x010, 0x1C8, 0x100, 0x004, 0x100, 0x144, 0x0C0, 0x1C4,
+	0x002, 0x100, 0x100, 0x1C2, 0x1C1, 0x080, 0x010, 0x100, 0x010, 0x020, 0x1B0, 0x1A8,
+	0x080, 0x128, 0x088, 0x1A8, 0x004, 0x080, 0x022, 0x100, 0x1A1, 0x080, 0x081, 0x1A1,
+	0x198, 0x090, 0x190, 0x014, 0x110, 0x014, 0x012, 0x190, 0x010, 0x010, 0x191, 0x190,
+	0x010, 0x010, 0x004, 0x100, 0x080, 0x002, 0x100, 0x18A, 0x180, 0x189, 0x186, 0x186,
+	0x004, 0x081, 0x185, 0x183, 0x183, 0x183, 0x170, 0x010, 0x010, 0x040, 0x168, 0x168,
+	0x004, 0x040, 0x002, 0x162, 0x161, 0x140, 0x158, 0x014, 0x100, 0x010, 0x012, 0x110,
+	0x010, 0x100, 0x010, 0x00C, 0x14C, 0x100, 0x001, 0x005, 0x145, 0x002, 0x138, 0x138,
+	0x104, 0x102, 0x100, 0x131, 0x004, 0x12C, 0x002, 0x100, 0x125, 0x123, 0x104, 0x102,
+	0x010, 0x100, 0x100, 0x0F0, 0x0F0, 0x010, 0x0E8, 0x020, 0x004, 0x0E4, 0x0E4, 0x0E2,
+	0x020, 0x0E1, 0x0E1, 0x0D8, 0x004, 0x0D4, 0x010, 0x0D1, 0x040, 0x004, 0x004, 0x0CA,
+	0x004, 0x0C5, 0x001, 0x0B8, 0x080, 0x010, 0x084, 0x002, 0x0B2, 0x0B1, 0x080, 0x004,
+	0x080, 0x002, 0x0AA, 0x0AA, 0x080, 0x0A3, 0x004, 0x095, 0x080, 0x08E, 0x078, 0x004,
+	0x072, 0x071, 0x044, 0x063, 0x004, 0x055, 0x040, 0x04E, 0x004, 0x002, 0x033, 0x02D,
+	0x1C0, 0x040, 0x040, 0x100, 0x180, 0x1C0, 0x080, 0x040, 0x040, 0x1C0, 0x1C0, 0x1A0,
+	0x1A0, 0x080, 0x100, 0x1A0, 0x100, 0x1A0, 0x020, 0x1A0, 0x1A0, 0x1A0, 0x190, 0x190,
+	0x190, 0x190, 0x010, 0x010, 0x010, 0x010, 0x100, 0x080, 0x188, 0x180, 0x100, 0x008,
+	0x188, 0x188, 0x088, 0x100, 0x004, 0x184, 0x080, 0x184, 0x184, 0x184, 0x080, 0x100,
+	0x002, 0x182, 0x182, 0x182, 0x182, 0x002, 0x182, 0x182, 0x001, 0x180, 0x181, 0x181,
+	0x181, 0x001, 0x181, 0x181, 0x160, 0x040, 0x100, 0x100, 0x160, 0x160, 0x150, 0x140,
+	0x050, 0x150, 0x050, 0x010, 0x100, 0x144, 0x144, 0x144, 0x040, 0x100, 0x144, 0x042,
+	0x142, 0x040, 0x040, 0x142, 0x001, 0x100, 0x141, 0x130, 0x130, 0x100, 0x130, 0x128,
+	0x100, 0x100, 0x100, 0x104, 0x002, 0x102, 0x020, 0x101, 0x120, 0x021, 0x118, 0x018,
+	0x010, 0x018, 0x118, 0x010, 0x110, 0x010, 0x004, 0x102, 0x010, 0x112, 0x001, 0x010,
+	0x011, 0x111, 0x104, 0x008, 0x100, 0x102, 0x00A, 0x10A, 0x008, 0x001, 0x106, 0x105,
+	0x004, 0x100, 0x040, 0x040, 0x0E0, 0x080, 0x0A0, 0x0E0, 0x040, 0x040, 0x010, 0x0D0,
+	0x080, 0x044, 0x084, 0x084, 0x040, 0x0C2, 0x0C2, 0x040, 0x001, 0x080, 0x040, 0x0B0,
+	0x0B0, 0x080, 0x0B0, 0x010, 0x010, 0x0A8, 0x080, 0x080, 0x008, 0x0A8, 0x0A8, 0x084,
+	0x002, 0x002, 0x0A0, 0x001, 0x0A0, 0x020, 0x001, 0x098, 0x010, 0x008, 0x010, 0x004,
+	0x010, 0x010, 0x010, 0x002, 0x010, 0x012, 0x092, 0x081, 0x011, 0x084, 0x08C, 0x00A,
+	0x008, 0x001, 0x086, 0x080, 0x085, 0x080, 0x040, 0x070, 0x068, 0x004, 0x042, 0x060,
+	0x001, 0x060, 0x044, 0x050, 0x042, 0x050, 0x041, 0x004, 0x040, 0x045, 0x040, 0x038,
+	0x010, 0x002, 0x001, 0x031, 0x004, 0x002, 0x001, 0x020, 0x01A, 0x019, 0x010, 0x010,
+	0x180, 0x180, 0x080, 0x100, 0x180, 0x100, 0x080, 0x180, 0x180, 0x180, 0x180, 0x180,
+	0x180, 0x180, 0x080, 0x100, 0x140, 0x040, 0x040, 0x100, 0x100, 0x140, 0x100, 0x040,
+	0x040, 0x140, 0x140, 0x120, 0x120, 0x100, 0x100, 0x100, 0x020, 0x120, 0x110, 0x100,
+	0x110, 0x100, 0x010, 0x010, 0x010, 0x010, 0x010, 0x110, 0x108, 0x100, 0x100, 0x008,
+	0x108, 0x108, 0x008, 0x100, 0x104, 0x104, 0x100, 0x104, 0x104, 0x100, 0x002, 0x102,
+	0x100, 0x102, 0x102, 0x002, 0x001, 0x100, 0x100, 0x101, 0x101, 0x001, 0x101, 0x101,
+	0x040, 0x040, 0x0C0, 0x080, 0x080, 0x040, 0x040, 0x0A0, 0x0A0, 0x080, 0x0A0, 0x080,
+	0x080, 0x0A0, 0x020, 0x0A0, 0x0A0, 0x0A0, 0x090, 0x090, 0x080, 0x090, 0x010, 0x010,
+	0x010, 0x010, 0x090, 0x010, 0x080, 0x008, 0x088, 0x088, 0x008, 0x088, 0x004, 0x084,
+	0x080, 0x080, 0x084, 0x084, 0x002, 0x002, 0x080, 0x082, 0x082, 0x002, 0x082, 0x082,
+	0x001, 0x080, 0x080, 0x001, 0x040, 0x060, 0x060, 0x060, 0x040, 0x040, 0x050, 0x050,
+	0x048, 0x044, 0x004, 0x044, 0x040, 0x042, 0x040, 0x040, 0x001, 0x041, 0x040, 0x030,
+	0x030, 0x030, 0x010, 0x028, 0x028, 0x028, 0x028, 0x004, 0x002, 0x002, 0x020, 0x001,
+	0x020, 0x001, 0x018, 0x010, 0x008, 0x010, 0x010, 0x010, 0x002, 0x010, 0x001, 0x011,
+	0x004, 0x00A, 0x001, 0x006, 0x005, 0x003, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100,
+	0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100,
+	0x100, 0x100, 0x100, 0x100, 0x080, 0x080, 0x080, 0x080, 0x080, 0x080, 0x080, 0x080,
+	0x080, 0x080, 0x080, 0x080, 0x080, 0x080, 0x080, 0x080, 0x080, 0x080, 0x080, 0x080,
+	0x080, 0x080, 0x040, 0x040, 0x040, 0x040, 0x040, 0x040, 0x020, 0x020, 0x020, 0x020,
+	0x020, 0x020, 0x010, 0x010, 0x010, 0x010, 0x010, 0x010, 0x010, 0x010, 0x010, 0x010,
+	0x010, 0x010, 0x010, 0x008, 0x008, 0x008, 0x008, 0x008, 0x008, 0x004, 0x004, 0x004,
+	0x004, 0x004, 0x004, 0x002, 0x002, 0x002, 0x002, 0x001, 0x001, 0x001, 0x001, 0x000,
+	0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+	0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+};
+
+#endif  //EE33_MOVE_TABLE_DATA_H
@@ -0,0 +1,497 @@
+/**
+  * @file      EE33_Qubic.cpp
+  * @version   v1.0
+  * @author    3lectron3ats <3lectron3ats@gmail.com>
+  * @date      2026.10.16
+  * @brief     Qubic, 4 in a line on 4x4x4 cube, on 64-bit bitmaps.
+  * @copyright GPL v3.0
+  * *************************************************************************************
+  * @attention
+  * <h2><center>&copy; COPYRIGHT 2023 3lectron3ats </center></h2>
+  * *************************************************************************************
+  */
+
+#include <EE33_Tic_Tac_Toe.h>
+#include <EE33_Qubic.h>
+
+#define QUBIC_OTHER(player)  ((player == PLAYER_TYPE_FRIEND) ? PLAYER_TYPE_ENMY : PLAYER_TYPE_FRIEND)
+
+/** 76 lines of 4x4x4 cube, cell = column + 4 * row + 16 * level */
+const uint64_t qubic_line_mask[QUBIC_LINE_TOTAL] PROGMEM =
+{
+	0x000000000000000FULL, 0x00000000000000F0ULL, 0x0000000000000F00ULL, 0x000000000000F000ULL,  //rows
+	0x00000000000F0000ULL, 0x0000000000F00000ULL, 0x000000000F000000ULL, 0x00000000F0000000ULL,
+	0x0000000F00000000ULL, 0x000000F000000000ULL, 0x00000F0000000000ULL, 0x0000F00000000000ULL,
+	0x000F000000000000ULL, 0x00F0000000000000ULL, 0x0F00000000000000ULL, 0xF000000000000000ULL,
+	0x0000000000001111ULL, 0x0000000000002222ULL, 0x0000000000004444ULL, 0x0000000000008888ULL,  //columns
+	0x0000000011110000ULL, 0x0000000022220000ULL, 0x0000000044440000ULL, 0x0000000088880000ULL,
+	0x0000111100000000ULL, 0x0000222200000000ULL, 0x0000444400000000ULL, 0x0000888800000000ULL,
+	0x1111000000000000ULL, 0x2222000000000000ULL, 0x4444000000000000ULL, 0x8888000000000000ULL,
+	0x0001000100010001ULL, 0x0002000200020002ULL, 0x0004000400040004ULL, 0x0008000800080008ULL,  //pillars
+	0x0010001000100010ULL, 0x0020002000200020ULL, 0x0040004000400040ULL, 0x0080008000800080ULL,
+	0x0100010001000100ULL, 0x0200020002000200ULL, 0x0400040004000400ULL, 0x0800080008000800ULL,
+	0x1000100010001000ULL, 0x2000200020002000ULL, 0x4000400040004000ULL, 0x8000800080008000ULL,
+	0x0000000000001248ULL, 0x0000000012480000ULL, 0x0000124800000000ULL, 0x1248000000000000ULL,  //diagonals of planes
+	0x0000000000008421ULL, 0x0000000084210000ULL, 0x0000842100000000ULL, 0x8421000000000000ULL,
+	0x0001001001001000ULL, 0x0002002002002000ULL, 0x0004004004004000ULL, 0x0008008008008000ULL,
+	0x0001000200040008ULL, 0x0010002000400080ULL, 0x0100020004000800ULL, 0x1000200040008000ULL,
+	0x0008000400020001ULL, 0x0080004000200010ULL, 0x0800040002000100ULL, 0x8000400020001000ULL,
+	0x1000010000100001ULL, 0x2000020000200002ULL, 0x4000040000400004ULL, 0x8000080000800008ULL,
+	0x0001002004008000ULL,  //diagonals of cube
+	0x0008004002001000ULL,
+	0x1000020000400008ULL,
+	0x8000040000200001ULL,
+};
+
+/** lines through every cell, QUBIC_LINE_NONE pads cells on 4 lines */
+const uint8_t qubic_cell_line[QUBIC_CELL_TOTAL][QUBIC_CELL_LINE_MAX] PROGMEM =
+{
+	{ 0, 16, 32, 52, 64, 68, 75},  //0
+	{ 0, 17, 33, 69, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //1
+	{ 0, 18, 34, 70, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //2
+	{ 0, 19, 35, 48, 60, 71, 74},  //3
+	{ 1, 16, 36, 65, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //4
+	{ 1, 17, 37, 52, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //5
+	{ 1, 18, 38, 48, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //6
+	{ 1, 19, 39, 61, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //7
+	{ 2, 16, 40, 66, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //8
+	{ 2, 17, 41, 48, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //9
+	{ 2, 18, 42, 52, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //10
+	{ 2, 19, 43, 62, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //11
+	{ 3, 16, 44, 48, 56, 67, 73},  //12
+	{ 3, 17, 45, 57, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //13
+	{ 3, 18, 46, 58, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //14
+	{ 3, 19, 47, 52, 59, 63, 72},  //15
+	{ 4, 20, 32, 53, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //16
+	{ 4, 21, 33, 64, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //17
+	{ 4, 22, 34, 60, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //18
+	{ 4, 23, 35, 49, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //19
+	{ 5, 20, 36, 68, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //20
+	{ 5, 21, 37, 53, 65, 69, 75},  //21
+	{ 5, 22, 38, 49, 61, 70, 74},  //22
+	{ 5, 23, 39, 71, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //23
+	{ 6, 20, 40, 56, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //24
+	{ 6, 21, 41, 49, 57, 66, 73},  //25
+	{ 6, 22, 42, 53, 58, 62, 72},  //26
+	{ 6, 23, 43, 59, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //27
+	{ 7, 20, 44, 49, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //28
+	{ 7, 21, 45, 67, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //29
+	{ 7, 22, 46, 63, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //30
+	{ 7, 23, 47, 53, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //31
+	{ 8, 24, 32, 54, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //32
+	{ 8, 25, 33, 60, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //33
+	{ 8, 26, 34, 64, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //34
+	{ 8, 27, 35, 50, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //35
+	{ 9, 24, 36, 56, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //36
+	{ 9, 25, 37, 54, 57, 61, 72},  //37
+	{ 9, 26, 38, 50, 58, 65, 73},  //38
+	{ 9, 27, 39, 59, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //39
+	{10, 24, 40, 68, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //40
+	{10, 25, 41, 50, 62, 69, 74},  //41
+	{10, 26, 42, 54, 66, 70, 75},  //42
+	{10, 27, 43, 71, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //43
+	{11, 24, 44, 50, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //44
+	{11, 25, 45, 63, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //45
+	{11, 26, 46, 67, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //46
+	{11, 27, 47, 54, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //47
+	{12, 28, 32, 55, 56, 60, 72},  //48
+	{12, 29, 33, 57, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //49
+	{12, 30, 34, 58, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //50
+	{12, 31, 35, 51, 59, 64, 73},  //51
+	{13, 28, 36, 61, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //52
+	{13, 29, 37, 55, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //53
+	{13, 30, 38, 51, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //54
+	{13, 31, 39, 65, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //55
+	{14, 28, 40, 62, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //56
+	{14, 29, 41, 51, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //57
+	{14, 30, 42, 55, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //58
+	{14, 31, 43, 66, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //59
+	{15, 28, 44, 51, 63, 68, 74},  //60
+	{15, 29, 45, 69, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //61
+	{15, 30, 46, 70, QUBIC_LINE_NONE, QUBIC_LINE_NONE, QUBIC_LINE_NONE},  //62
+	{15, 31, 47, 55, 67, 71, 75},  //63
+};
+
+/** cells on 7 lines(corners and center of cube) first, then the others */
+const uint8_t qubic_static_order[QUBIC_CELL_TOTAL] PROGMEM =
+{
+	0, 3, 12, 15, 21, 22, 25, 26,
+	37, 38, 41, 42, 48, 51, 60, 63,
+	1, 2, 4, 5, 6, 7, 8, 9, 10, 11, 13, 14, 16, 17, 18, 19,
+	20, 23, 24, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 39, 40, 43,
+	44, 45, 46, 47, 49, 50, 52, 53, 54, 55, 56, 57, 58, 59, 61, 62,
+};
+
+/** score of a line with n pieces of one player only, 4 is bingo and scored by search */
+const int8_t qubic_line_value[QUBIC_LENGTH + 1] PROGMEM = {0, 1, 4, 32, 0};
+
+QubicBoard::QubicBoard()
+{
+	clear();
+
+	search_horizon = QUBIC_SEARCH_DEPTH;
+	search_abort = false;
+	search_budget_us = 0;
+	search_start_us = 0;
+	reset_SearchNode();
+}
+
+void QubicBoard::clear(void)
+{
+	memset(map, 0, sizeof(map));
+	memset(line_count, 0, sizeof(line_count));
+	memset(threat, 0, sizeof(threat));
+	memset(bingo, 0, sizeof(bingo));
+
+	score_sum = 0;
+}
+
+uint8_t QubicBoard::cell(uint8_t column, uint8_t row, uint8_t level)
+{
+	return column + QUBIC_LENGTH * row + QUBIC_LENGTH * QUBIC_LENGTH * level;
+}
+
+uint64_t QubicBoard::get_Line(uint8_t line)
+{
+	const uint32_t *p_mask = (const uint32_t *)&qubic_line_mask[line];
+
+	//no 64-bit flash read on AVR, low word first on AVR and host
+	return ((uint64_t)pgm_read_dword(p_mask + 1) << 32) | pgm_read_dword(p_mask);
+}
+
+bool QubicBoard::set_Cell(uint8_t cell, PLAYER_TYPE player)
+{
+	if (cell >= QUBIC_CELL_TOTAL || ((map[PLAYER_TYPE_FRIEND] | map[PLAYER_TYPE_ENMY]) & QUBIC_BIT(cell)))
+	{
+		return false;
+	}
+
+	_make(cell, player);
+
+	return true;
+}
+
+uint64_t QubicBoard::get_Map(PLAYER_TYPE player)
+{
+	return map[player];
+}
+
+uint64_t QubicBoard::get_Threat(PLAYER_TYPE player)
+{
+	return (threat[player]) ? _line_empty(player, QUBIC_LENGTH - 1) : 0;
+}
+
+bool QubicBoard::Is_Bingo(PLAYER_TYPE player)
+{
+	return bingo[player] != 0;
+}
+
+bool QubicBoard::Is_Full(void)
+{
+	return (map[PLAYER_TYPE_FRIEND] | map[PLAYER_TYPE_ENMY]) == ~(uint64_t)0;
+}
+
+int16_t QubicBoard::get_Score(void)
+{
+	return score_sum;
+}
+
+uint8_t QubicBoard::BestNextMove(PLAYER_TYPE player, uint32_t budget_us)
+{
+	PLAYER_TYPE other = QUBIC_OTHER(player);
+	uint8_t BestMove = QUBIC_CELL_NONE;
+
+	if (Is_Full())
+	{
+		return QUBIC_CELL_NONE;
+	}
+
+	search_abort = false;
+	search_budget_us = 0;  //first round is never stopped, there must be a move
+	search_start_us = micros();
+
+	for (search_horizon = (budget_us) ? 1 : QUBIC_SEARCH_DEPTH; search_horizon <= QUBIC_SEARCH_DEPTH; search_horizon++)
+	{
+		uint64_t priority, remaining = _moves(player, &priority);
+		uint8_t RoundMove = QUBIC_CELL_NONE, ties = 0;
+		int16_t ScoreMax = -QUBIC_SCORE_INFINITE, score;
+
+		while (remaining && !search_abort)
+		{
+			uint8_t move = _pick(&remaining, priority);
+
+			_make(move, player);
+
+			//window above ScoreMax - 1, so a score inside is exact and a tie is a tie
+			score = -_search(other, -QUBIC_SCORE_INFINITE, (ScoreMax == -QUBIC_SCORE_INFINITE) ? QUBIC_SCORE_INFINITE : -(ScoreMax - 1));
+
+			_unmake(move, player);
+
+			if (search_abort)
+			{
+				break;
+			}
+
+			if (score > ScoreMax)
+			{
+				ScoreMax = score;
+				RoundMove = move;
+				ties = 1;
+			}
+			else if (score == ScoreMax && random(++ties) == 0)
+			{
+				RoundMove = move;
+			}
+		}
+
+		if (search_abort)
+		{
+			break;
+		}
+
+		BestMove = RoundMove;
+		search_budget_us = budget_us;
+
+		if (ScoreMax >= QUBIC_SCORE_WIN - QUBIC_SEARCH_DEPTH || ScoreMax <= -(QUBIC_SCORE_WIN - QUBIC_SEARCH_DEPTH))
+		{
+			break;  //game is decided, deeper search does not change it
+		}
+	}
+
+	return BestMove;
+}
+
+uint32_t QubicBoard::get_SearchNode(void)
+{
+	return search_node;
+}
+
+void QubicBoard::reset_SearchNode(void)
+{
+	search_node = 0;
+}
+
+uint16_t QubicBoard::get_SearchStackSize(void)
+{
+	return sizeof(T_QUBIC_FRAME) * QUBIC_SEARCH_DEPTH;
+}
+
+
+void QubicBoard::_line_apply(uint8_t count, int8_t sign)
+{
+	uint8_t count_friend = count & 0x0F, count_enmy = count >> 4;
+
+	if (!count_enmy)
+	{
+		score_sum += sign * (int8_t)pgm_read_byte(&qubic_line_value[count_friend]);
+		threat[PLAYER_TYPE_FRIEND] += (count_friend == QUBIC_LENGTH - 1) ? sign : 0;
+		bingo[PLAYER_TYPE_FRIEND] += (count_friend == QUBIC_LENGTH) ? sign : 0;
+	}
+
+	if (!count_friend)
+	{
+		score_sum -= sign * (int8_t)pgm_read_byte(&qubic_line_value[count_enmy]);
+		threat[PLAYER_TYPE_ENMY] += (count_enmy == QUBIC_LENGTH - 1) ? sign : 0;
+		bingo[PLAYER_TYPE_ENMY] += (count_enmy == QUBIC_LENGTH) ? sign : 0;
+	}
+}
+
+void QubicBoard::_make(uint8_t cell, PLAYER_TYPE player)
+{
+	uint8_t step = (player == PLAYER_TYPE_FRIEND) ? 0x01 : 0x10;
+
+	map[player] |= QUBIC_BIT(cell);
+
+	for (uint8_t i = 0; i < QUBIC_CELL_LINE_MAX; i++)
+	{
+		uint8_t line = pgm_read_byte(&qubic_cell_line[cell][i]);
+
+		if (line == QUBIC_LINE_NONE)
+		{
+			break;
+		}
+
+		_line_apply(line_count[line], -1);
+		line_count[line] += step;
+		_line_apply(line_count[line], 1);
+	}
+}
+
+void QubicBoard::_unmake(uint8_t cell, PLAYER_TYPE player)
+{
+	uint8_t step = (player == PLAYER_TYPE_FRIEND) ? 0x01 : 0x10;
+
+	map[player] &= ~QUBIC_BIT(cell);
+
+	for (uint8_t i = 0; i < QUBIC_CELL_LINE_MAX; i++)
+	{
+		uint8_t line = pgm_read_byte(&qubic_cell_line[cell][i]);
+
+		if (line == QUBIC_LINE_NONE)
+		{
+			break;
+		}
+
+		_line_apply(line_count[line], -1);
+		line_count[line] -= step;
+		_line_apply(line_count[line], 1);
+	}
+}
+
+uint64_t QubicBoard::_line_empty(PLAYER_TYPE player, uint8_t own_count)
+{
+	uint8_t count = (player == PLAYER_TYPE_FRIEND) ? own_count : own_count << 4;
+	uint64_t cells = 0;
+
+	//only lines with the right count are read from flash
+	for (uint8_t line = 0; line < QUBIC_LINE_TOTAL; line++)
+	{
+		if (line_count[line] == count)
+		{
+			cells |= get_Line(line);
+		}
+	}
+
+	return cells & ~(map[PLAYER_TYPE_FRIEND] | map[PLAYER_TYPE_ENMY]);
+}
+
+uint64_t QubicBoard::_moves(PLAYER_TYPE player, uint64_t *priority)
+{
+	PLAYER_TYPE other = QUBIC_OTHER(player);
+
+	*priority = 0;
+
+	if (threat[player])
+	{
+		return _line_empty(player, QUBIC_LENGTH - 1);
+	}
+
+	if (threat[other])
+	{
+		return _line_empty(other, QUBIC_LENGTH - 1);
+	}
+
+	*priority = _line_empty(player, QUBIC_LENGTH - 2);
+
+	return ~(map[PLAYER_TYPE_FRIEND] | map[PLAYER_TYPE_ENMY]);
+}
+
+uint8_t QubicBoard::_pick(uint64_t *remaining, uint64_t priority)
+{
+	uint64_t moves = (*remaining & priority) ? *remaining & priority : *remaining;
+	uint8_t move = QUBIC_CELL_NONE;
+
+	for (uint8_t i = 0; i < QUBIC_CELL_TOTAL; i++)
+	{
+		move = pgm_read_byte(&qubic_static_order[i]);
+
+		if (moves & QUBIC_BIT(move))
+		{
+			break;
+		}
+	}
+
+	*remaining &= ~QUBIC_BIT(move);
+
+	return move;
+}
+
+void QubicBoard::_search_enter(T_QUBIC_FRAME *frame, PLAYER_TYPE player, int16_t alpha, int16_t beta, uint8_t ply)
+{
+	search_node++;
+
+	if (search_budget_us && !(search_node & (QUBIC_TIME_CHECK_NODES - 1)) && micros() - search_start_us >= search_budget_us)
+	{
+		search_abort = true;
+	}
+
+	frame->remaining = 0;
+	frame->priority = 0;
+
+	if (bingo[QUBIC_OTHER(player)])
+	{
+		//the other one just won, quicker win is worse for us
+		frame->best = -(QUBIC_SCORE_WIN - ply);
+	}
+	else if (Is_Full())
+	{
+		frame->best = 0;
+	}
+	else if (threat[player])
+	{
+		//wins with the next move, no need to search it
+		frame->best = QUBIC_SCORE_WIN - (ply + 1);
+	}
+	else if (ply >= search_horizon)
+	{
+		frame->best = (player == PLAYER_TYPE_FRIEND) ? score_sum : -score_sum;
+	}
+	else
+	{
+		frame->remaining = _moves(player, &frame->priority);
+		frame->alpha = alpha;
+		frame->beta = beta;
+		frame->best = -QUBIC_SCORE_INFINITE;
+	}
+}
+
+int16_t QubicBoard::_search(PLAYER_TYPE player, int16_t alpha, int16_t beta)
+{
+	T_QUBIC_FRAME *frame = &search_stack[0];
+	PLAYER_TYPE turn = player;
+	int16_t score;
+
+	_search_enter(frame, turn, alpha, beta, 1);
+
+	while (!search_abort)
+	{
+		if (frame->remaining)
+		{
+			frame->move = _pick(&frame->remaining, frame->priority);
+			_make(frame->move, turn);
+			turn = QUBIC_OTHER(turn);
+
+			_search_enter(frame + 1, turn, -frame->beta, -frame->alpha, frame - &search_stack[0] + 2);
+
+			frame++;
+			continue;
+		}
+
+		score = frame->best;
+
+		if (frame == &search_stack[0])
+		{
+			return score;
+		}
+
+		frame--;
+		turn = QUBIC_OTHER(turn);
+		_unmake(frame->move, turn);
+		score = -score;
+
+		frame->best = (score > frame->best) ? score : frame->best;
+		frame->alpha = (score > frame->alpha) ? score : frame->alpha;
+
+		if (frame->beta <= frame->alpha)
+		{
+			frame->remaining = 0;
+		}
+	}
+
+	//out of time, take the moves on stack back, caller drops the score
+	while (frame != &search_stack[0])
+	{
+		frame--;
+		turn = QUBIC_OTHER(turn);
+		_unmake(frame->move, turn);
+	}
+
+	return 0;
+}
+
+
+/*
+ * @release note
+ * | v1.0 2026-10-16 - 3lectron3ats : Initial Release
+ * #
+*/
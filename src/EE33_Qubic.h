@@ -0,0 +1,251 @@
+/**
+  * @file      EE33_Qubic.h
+  * @version   v1.0
+  * @author    3lectron3ats <3lectron3ats@gmail.com>
+  * @date      2026.10.16
+  * @brief     Qubic, 4 in a line on 4x4x4 cube, on 64-bit bitmaps.
+  * @copyright GPL v3.0
+  * *************************************************************************************
+  * @attention
+  * <h2><center>&copy; COPYRIGHT 2023 3lectron3ats </center></h2>
+  * *************************************************************************************
+  * @note
+  *   Cell is column + 4 * row + 16 * level, bit n of the uint64_t map of a player.
+  *   The 76 lines are uint64_t masks in flash like StraightLine_3X3, and every cell
+  *   has the list of the 4 or 7 lines through it. Pieces of both players on each line
+  *   are counted piece by piece, so the score, threats(3 in a line and the 4th empty)
+  *   and bingo are known without scanning the cube.
+  *   Search is alpha-beta on QUBIC_SEARCH_DEPTH frames and moves by threats: a threat
+  *   of the one to move wins at once, a threat of the other must be blocked, else moves
+  *   making a threat go first, then corners and center cells(7 lines each).
+  * @par    sample code
+  * @code
+  *       QubicBoard cube;
+  *
+  *       cube.set_Cell(QubicBoard::cell(1, 1, 1), PLAYER_TYPE_ENMY);
+  *       next_step = cube.BestNextMove(PLAYER_TYPE_FRIEND, 1000000);
+  * @endcode
+  */
+
+
+#ifndef EE33_QUBIC_H
+#define EE33_QUBIC_H
+
+// Arduino versioning.
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "Arduino.h"	// for digitalRead, digitalWrite, etc
+#else
+#include "WProgram.h"
+#endif
+
+#include <EE33_Matrix.h>
+
+#define QUBIC_VERSION_MAJOR  1
+#define QUBIC_VERSION_MINOR  0
+
+/** cells on a line, also columns, rows and levels of cube */
+#define QUBIC_LENGTH             4
+
+#define QUBIC_CELL_TOTAL         64
+#define QUBIC_LINE_TOTAL         76
+
+/** lines through a corner or center cell, other cells have 4 */
+#define QUBIC_CELL_LINE_MAX      7
+
+/** pad of qubic_cell_line */
+#define QUBIC_LINE_NONE          0xFF
+
+/** no cell, cube full */
+#define QUBIC_CELL_NONE          0xFF
+
+/** score of winning the game, bigger than any guess */
+#define QUBIC_SCORE_WIN          10000
+
+/** bigger than any score, bound of the full alpha-beta window */
+#define QUBIC_SCORE_INFINITE     (QUBIC_SCORE_WIN + 1)
+
+/** plies searched without time budget, also frames of search stack */
+#define QUBIC_SEARCH_DEPTH       8
+
+/** nodes between two checks of the time budget, must be power of 2 */
+#define QUBIC_TIME_CHECK_NODES   64
+
+#define QUBIC_BIT(cell)          ((uint64_t)1 << (cell))
+
+/*! one position of the search, the cube itself is kept on QubicBoard */
+typedef struct
+{
+	uint64_t remaining;        /*!< moves not searched yet */
+	uint64_t priority;         /*!< moves making a threat, searched first */
+	uint8_t  move;             /*!< move being searched */
+	int16_t  alpha;
+	int16_t  beta;
+	int16_t  best;             /*!< best score of searched moves */
+} T_QUBIC_FRAME;
+
+
+class QubicBoard
+{
+public:
+
+/**
+	* @brief  construction, empty cube
+	*/
+	QubicBoard();
+
+/**
+	* @brief  take all pieces away
+	*/
+	void clear(void);
+
+/**
+	* @brief  cell of cube
+	* @param  column 0 ~ 3
+	* @param  row 0 ~ 3
+	* @param  level 0 ~ 3
+	* @return column + 4 * row + 16 * level
+	*/
+	static uint8_t cell(uint8_t column, uint8_t row, uint8_t level);
+
+/**
+	* @brief  get a line
+	* @param  line 0 ~ QUBIC_LINE_TOTAL - 1
+	* @return mask of its 4 cells
+	*/
+	static uint64_t get_Line(uint8_t line);
+
+/**
+	* @brief  put a piece
+	* @param  cell
+	* @param  player
+	* @retval true done
+	* @retval false cell is taken or out of cube
+	*/
+	bool set_Cell(uint8_t cell, PLAYER_TYPE player);
+
+/**
+	* @brief  get pieces of player
+	* @return bit n is cell n
+	*/
+	uint64_t get_Map(PLAYER_TYPE player);
+
+/**
+	* @brief  cells where player wins at once
+	* @return bit n is cell n, 0 means no threat
+	*/
+	uint64_t get_Threat(PLAYER_TYPE player);
+
+/**
+	* @brief  player has 4 in a line or not
+	*/
+	bool Is_Bingo(PLAYER_TYPE player);
+
+/**
+	* @brief  all cells are taken or not
+	*/
+	bool Is_Full(void);
+
+/**
+	* @brief  guess of the position
+	* @return score in view of friend, the same one search uses at its horizon
+	*/
+	int16_t get_Score(void);
+
+/**
+	* @brief  calculate the next step of player
+	* @param  player the one to move
+	* @param  budget_us time limit in microseconds, 0 means search QUBIC_SEARCH_DEPTH plies
+	* @return cell, QUBIC_CELL_NONE means cube full
+	* @note   with budget, search goes one ply deeper each round and the best move of
+	*         the last finished round is taken. Moves of the same score are picked
+	*         randomly.
+	*/
+	uint8_t BestNextMove(PLAYER_TYPE player, uint32_t budget_us = 0);
+
+/**
+	* @brief  get positions visited by search
+	* @return node counter, it keeps adding up until reset_SearchNode
+	*/
+	uint32_t get_SearchNode(void);
+
+/**
+	* @brief  clear node counter
+	*/
+	void reset_SearchNode(void);
+
+/**
+	* @brief  get SRAM bytes of search stack
+	*/
+	static uint16_t get_SearchStackSize(void);
+
+private:
+
+/**
+	* @brief  add(sign 1) or take away(sign -1) what a line counts for
+	* @param  count pieces of friend in low nibble, enmy in high nibble
+	*/
+	void _line_apply(uint8_t count, int8_t sign);
+
+	void _make(uint8_t cell, PLAYER_TYPE player);
+
+	void _unmake(uint8_t cell, PLAYER_TYPE player);
+
+/**
+	* @brief  empty cells of lines with own pieces only
+	* @param  player
+	* @param  own_count pieces of player on the line, 3 finds wins, 2 finds threats to make
+	*/
+	uint64_t _line_empty(PLAYER_TYPE player, uint8_t own_count);
+
+/**
+	* @brief  moves of a position, only the blocks if the other one has a threat
+	* @param  priority moves to search first
+	*/
+	uint64_t _moves(PLAYER_TYPE player, uint64_t *priority);
+
+/**
+	* @brief  take the next move, priority first, then in qubic_static_order
+	*/
+	uint8_t _pick(uint64_t *remaining, uint64_t priority);
+
+/**
+	* @brief  set up the frame of a position, score it at once if game over or horizon
+	* @note   frame without remaining moves is done, its score is frame->best
+	*/
+	void _search_enter(T_QUBIC_FRAME *frame, PLAYER_TYPE player, int16_t alpha, int16_t beta, uint8_t ply);
+
+/**
+	* @brief  score of position in view of player, player to move
+	*/
+	int16_t _search(PLAYER_TYPE player, int16_t alpha, int16_t beta);
+
+	uint64_t map[PLAYER_TYPE_MAX + 1];
+
+	/** pieces on every line, friend in low nibble, enmy in high nibble */
+	uint8_t line_count[QUBIC_LINE_TOTAL];
+
+	/** lines with 3 pieces of player and the 4th empty */
+	uint8_t threat[PLAYER_TYPE_MAX + 1];
+
+	/** lines with 4 pieces of player */
+	uint8_t bingo[PLAYER_TYPE_MAX + 1];
+
+	/** guess of the position in view of friend */
+	int16_t score_sum;
+
+	T_QUBIC_FRAME search_stack[QUBIC_SEARCH_DEPTH];
+	uint8_t search_horizon;
+	bool search_abort;
+	uint32_t search_budget_us;
+	uint32_t search_start_us;
+	uint32_t search_node;
+};
+
+#endif  //EE33_QUBIC_H
+
+
+/*
+ * @release note
+ * | v1.0 2026-10-16 - 3lectron3ats : Initial Release
+ * #
+*/
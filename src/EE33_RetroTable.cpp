@@ -0,0 +1,136 @@
+/**
+  * @file      EE33_RetroTable.cpp
+  * @version   v1.0
+  * @author    3lectron3ats <3lectron3ats@gmail.com>
+  * @date      2026.10.16
+  * @brief     Retrograde database of Tic-Tac-Toe stored in flash, value and distance.
+  * @copyright GPL v3.0
+  * *************************************************************************************
+  * @attention
+  * <h2><center>&copy; COPYRIGHT 2023 3lectron3ats </center></h2>
+  * *************************************************************************************
+  */
+
+#include <EE33_Tic_Tac_Toe.h>
+#include <EE33_RetroTable.h>
+#include <EE33_RetroTable_data.h>
+
+#define RETRO_CODE_DRAW      1
+#define RETRO_CODE_LOSE      2   /*!< 2 ~ 6, lose in 0, 2 ... 8 plies */
+#define RETRO_CODE_WIN       7   /*!< 7 ~ 11, win in 1, 3 ... 9 plies */
+
+uint16_t RetroTable::index(T_MATRIX_3X3 MatrixMap_Friend, T_MATRIX_3X3 MatrixMap_Enmy)
+{
+	uint16_t index = 0;
+	int8_t element;
+
+	for (element = MATRIX_3X3_M33; element >= MATRIX_3X3_M11; element--)
+	{
+		index = index * 3 + ((MatrixMap_Friend.d16 & bit(element)) ? 1 : (MatrixMap_Enmy.d16 & bit(element)) ? 2 : 0);
+	}
+
+	return index;
+}
+
+RETRO_VALUE RetroTable::read(T_MATRIX_3X3 MatrixMap_Friend, T_MATRIX_3X3 MatrixMap_Enmy, uint8_t *distance)
+{
+	uint8_t code;
+
+	if (MatrixMap_Friend.d16 & MatrixMap_Enmy.d16)
+	{
+		return RETRO_VALUE_INVALID;  //one LED can not be both friend and enmy
+	}
+
+	code = _code(index(MatrixMap_Friend, MatrixMap_Enmy));
+
+	if (code >= RETRO_CODE_WIN)
+	{
+		*distance = 2 * (code - RETRO_CODE_WIN) + 1;
+		return RETRO_VALUE_WIN;
+	}
+
+	if (code >= RETRO_CODE_LOSE)
+	{
+		*distance = 2 * (code - RETRO_CODE_LOSE);
+		return RETRO_VALUE_LOSE;
+	}
+
+	if (code == RETRO_CODE_DRAW)
+	{
+		//tie lasts until matrix is full
+		for (*distance = 0, code = MATRIX_3X3_M11; code < MATRIX_3X3_ELEMENT_TOTAL; code++)
+		{
+			*distance += ((MatrixMap_Friend.d16 | MatrixMap_Enmy.d16) & bit(code)) ? 0 : 1;
+		}
+
+		return RETRO_VALUE_DRAW;
+	}
+
+	return RETRO_VALUE_INVALID;
+}
+
+uint16_t RetroTable::read(T_MATRIX_3X3 MatrixMap_Friend, T_MATRIX_3X3 MatrixMap_Enmy)
+{
+	uint16_t moves = 0;
+	uint8_t element, distance;
+	int8_t rank, best = INT8_MIN;
+
+	if (read(MatrixMap_Friend, MatrixMap_Enmy, &distance) == RETRO_VALUE_INVALID)
+	{
+		return RETRO_TABLE_INVALID;
+	}
+
+	for (element = MATRIX_3X3_M11; element < MATRIX_3X3_ELEMENT_TOTAL; element++)
+	{
+		T_MATRIX_3X3 child = MatrixMap_Friend;
+
+		if ((MatrixMap_Friend.d16 | MatrixMap_Enmy.d16) & bit(element))
+		{
+			continue;
+		}
+
+		child.d16 |= bit(element);
+
+		//value of child is in view of enmy
+		switch (read(MatrixMap_Enmy, child, &distance))
+		{
+		case RETRO_VALUE_LOSE:
+			rank = MATRIX_3X3_ELEMENT_TOTAL * 2 - distance;
+			break;
+		case RETRO_VALUE_DRAW:
+			rank = 0;
+			break;
+		case RETRO_VALUE_WIN:
+			rank = (int8_t)distance - MATRIX_3X3_ELEMENT_TOTAL * 2;
+			break;
+		default:
+			continue;  //game is over already
+		}
+
+		if (rank > best)
+		{
+			best = rank;
+			moves = bit(element);
+		}
+		else if (rank == best)
+		{
+			moves |= bit(element);
+		}
+	}
+
+	return moves;
+}
+
+uint8_t RetroTable::_code(uint16_t index)
+{
+	uint8_t data = pgm_read_byte(&retro_table[index >> 1]);
+
+	return (index & 1) ? (data >> 4) : (data & 0x0F);
+}
+
+
+/*
+ * @release note
+ * | v1.0 2026-10-16 - 3lectron3ats : Initial Release
+ * #
+*/
@@ -0,0 +1,92 @@
+/**
+  * @file      EE33_RetroTable.h
+  * @version   v1.0
+  * @author    3lectron3ats <3lectron3ats@gmail.com>
+  * @date      2026.10.16
+  * @brief     Retrograde database of Tic-Tac-Toe stored in flash, value and distance.
+  * @copyright GPL v3.0
+  * *************************************************************************************
+  * @attention
+  * <h2><center>&copy; COPYRIGHT 2023 3lectron3ats </center></h2>
+  * *************************************************************************************
+  * @note
+  *   Every position is numbered by index() in base 3, digit n is MATRIX_3X3_ELEMENT n:
+  *   0 empty, 1 friend(the next one to move), 2 enmy. 19683 slots of 4 bits each,
+  *   code 0 is a position which never happens in a game. Otherwise code tells win, tie
+  *   or lose of friend under perfect play and how many plies it lasts: winner takes
+  *   the shortest way, loser the longest, tie lasts until matrix is full.
+  *   Table data is generated by extras/tools/retro_gen.cpp.
+  */
+
+
+#ifndef EE33_RETRO_TABLE_H
+#define EE33_RETRO_TABLE_H
+
+// Arduino versioning.
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "Arduino.h"	// for digitalRead, digitalWrite, etc
+#else
+#include "WProgram.h"
+#endif
+
+#include <EE33_Matrix.h>
+
+#define RETRO_TABLE_VERSION_MAJOR  1
+#define RETRO_TABLE_VERSION_MINOR  0
+
+#define RETRO_TABLE_INDEX_TOTAL    19683
+#define RETRO_TABLE_SIZE           ((RETRO_TABLE_INDEX_TOTAL + 1) / 2)
+#define RETRO_TABLE_INVALID        0xFFFF
+
+typedef enum
+{
+	RETRO_VALUE_INVALID = 0,           /*!< position never happens in a game */
+	RETRO_VALUE_WIN,                   /*!< friend wins */
+	RETRO_VALUE_DRAW,                  /*!< tie */
+	RETRO_VALUE_LOSE,                  /*!< friend loses */
+} RETRO_VALUE;
+
+class RetroTable
+{
+public:
+
+/**
+	* @brief  calculate the ternary index of position
+	* @param  MatrixMap_Friend map of friend, friend is the next one to move
+	* @param  MatrixMap_Enmy map of enmy
+	* @return 0 ~ RETRO_TABLE_INDEX_TOTAL - 1
+	*/
+	static uint16_t index(T_MATRIX_3X3 MatrixMap_Friend, T_MATRIX_3X3 MatrixMap_Enmy);
+
+/**
+	* @brief  read the value of position
+	* @param  MatrixMap_Friend map of friend, friend is the next one to move
+	* @param  MatrixMap_Enmy map of enmy
+	* @param  distance plies to the end of game under perfect play
+	* @return value in view of friend
+	*/
+	static RETRO_VALUE read(T_MATRIX_3X3 MatrixMap_Friend, T_MATRIX_3X3 MatrixMap_Enmy, uint8_t *distance);
+
+/**
+	* @brief  find the best moves of position
+	* @param  MatrixMap_Friend map of friend, friend is the next one to move
+	* @param  MatrixMap_Enmy map of enmy
+	* @return mask of best moves(bit n is MATRIX_3X3_ELEMENT n), 0 means game over,
+	*         RETRO_TABLE_INVALID means position never happens in a game
+	* @note   win as soon as possible, else tie, else lose as late as possible.
+	*/
+	static uint16_t read(T_MATRIX_3X3 MatrixMap_Friend, T_MATRIX_3X3 MatrixMap_Enmy);
+
+private:
+
+	static uint8_t _code(uint16_t index);
+};
+
+#endif  //EE33_RETRO_TABLE_H
+
+
+/*
+ * @release note
+ * | v1.0 2026-10-16 - 3lectron3ats : Initial Release
+ * #
+*/
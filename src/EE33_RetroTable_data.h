@@ -0,0 +1,635 @@
+/**
+  * @file      EE33_RetroTable_data.h
+  * @brief     Generated by extras/tools/retro_gen.cpp, do not edit.
+  * @copyright GPL v3.0
+  */
+
+#ifndef EE33_RETRO_TABLE_DATA_H
+#define EE33_RETRO_TABLE_DATA_H
+
+#if RETRO_TABLE_SIZE != 9842
+#error "RETRO_TABLE_SIZE does not match the generated table"
+#endif
+
+/** code of ternary index n is in nibble n, low nibble first */
+const uint8_t retro_table[RETRO_TABLE_SIZE] PROGMEM =
+{
+	0x01, 0x01, 0x10, 0x91, 0x00, 0x90, 0x00, 0x90, 0x90, 0x91, 0x10, 0x10, 0x90, 0x00, 0x10, 0x00,
+	0x90, 0x40, 0x00, 0x00, 0x00, 0x00, 0x98, 0x40, 0x00, 0x98, 0x07, 0x91, 0x90, 0x40, 0x10, 0x90,
+	0x40, 0x00, 0x94, 0x08, 0x10, 0x10, 0x08, 0x00, 0x00, 0x10, 0x00, 0x90, 0x10, 0x00, 0x00, 0x00,
+	0x00, 0x17, 0x10, 0x00, 0x17, 0x07, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x07, 0x00, 0x07, 0x92, 0x10, 0x00, 0x17, 0x07, 0x00, 0x07, 0x00, 0x07, 0x17, 0x07, 0x07, 0x07,
+	0x07, 0x11, 0x10, 0x40, 0x10, 0x10, 0x10, 0x00, 0x11, 0x01, 0x10, 0x40, 0x01, 0x00, 0x10, 0x40,
+	0x00, 0x41, 0x07, 0x00, 0x01, 0x00, 0x01, 0x43, 0x07, 0x01, 0x03, 0x07, 0x10, 0x40, 0x07, 0x00,
+	0x10, 0x07, 0x07, 0x03, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x90, 0x00, 0x90, 0x90, 0x00, 0x00,
+	0x00, 0x00, 0x17, 0x40, 0x00, 0x48, 0x08, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x07, 0x00, 0x07, 0x12, 0x10, 0x00, 0x19, 0x08, 0x00, 0x07, 0x00, 0x07, 0x17, 0x01, 0x01,
+	0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x02,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x08, 0x03, 0x00, 0x00, 0x00, 0x70, 0x01, 0x03, 0x70, 0x71, 0x10, 0x40, 0x00, 0x41, 0x01, 0x00,
+	0x07, 0x00, 0x07, 0x47, 0x01, 0x01, 0x03, 0x03, 0x00, 0x04, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00,
+	0x70, 0x04, 0x03, 0x30, 0x73, 0x10, 0x08, 0x08, 0x03, 0x01, 0x07, 0x07, 0x70, 0x77, 0x00, 0x01,
+	0x11, 0x00, 0x00, 0x91, 0x90, 0x10, 0x90, 0x90, 0x10, 0x00, 0x18, 0x08, 0x40, 0x40, 0x04, 0x00,
+	0x10, 0x10, 0x00, 0x11, 0x07, 0x00, 0x01, 0x00, 0x08, 0x11, 0x07, 0x09, 0x01, 0x07, 0x90, 0x90,
+	0x07, 0x00, 0x90, 0x07, 0x07, 0x03, 0x08, 0x00, 0x00, 0x03, 0x00, 0x90, 0x10, 0x00, 0x17, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x17, 0x07, 0x07, 0x07, 0x07, 0x00, 0x01, 0x00, 0x08, 0x01, 0x00, 0x00,
+	0x00, 0x70, 0x01, 0x03, 0x70, 0x73, 0x90, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x70, 0x77, 0x00,
+	0x07, 0x77, 0x00, 0x00, 0x10, 0x40, 0x07, 0x00, 0x10, 0x07, 0x07, 0x03, 0x03, 0x00, 0x00, 0x03,
+	0x00, 0x10, 0x07, 0x08, 0x01, 0x07, 0x08, 0x01, 0x10, 0x71, 0x00, 0x07, 0x73, 0x00, 0x00, 0x00,
+	0x00, 0x02, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x90,
+	0x40, 0x00, 0x00, 0x00, 0x00, 0x97, 0x40, 0x00, 0x98, 0x07, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x07, 0x92, 0x90, 0x00, 0x98, 0x08, 0x00, 0x07, 0x00, 0x07,
+	0x17, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+	0x00, 0x07, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x08, 0x01, 0x70, 0x71, 0x10, 0x10, 0x00,
+	0x11, 0x07, 0x00, 0x08, 0x00, 0x01, 0x13, 0x07, 0x01, 0x01, 0x07, 0x00, 0x01, 0x00, 0x07, 0x03,
+	0x00, 0x00, 0x00, 0x30, 0x07, 0x03, 0x10, 0x07, 0x10, 0x01, 0x01, 0x03, 0x03, 0x01, 0x03, 0x30,
+	0x33, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x08, 0x00, 0x08, 0x08, 0x00, 0x00, 0x00, 0x70, 0x01, 0x01, 0x80, 0x81, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x20, 0x00, 0x08, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00, 0x70,
+	0x01, 0x03, 0x10, 0x73, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
+	0x70, 0x20, 0x08, 0x08, 0x80, 0x11, 0x00, 0x70, 0x00, 0x70, 0x70, 0x11, 0x10, 0x10, 0x10, 0x90,
+	0x10, 0x00, 0x98, 0x07, 0x00, 0x07, 0x00, 0x07, 0x97, 0x07, 0x09, 0x01, 0x07, 0x00, 0x01, 0x00,
+	0x07, 0x04, 0x00, 0x00, 0x00, 0x70, 0x07, 0x03, 0x10, 0x07, 0x90, 0x08, 0x08, 0x08, 0x08, 0x07,
+	0x07, 0x70, 0x77, 0x00, 0x03, 0x33, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x08, 0x03, 0x70, 0x73, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+	0x00, 0x70, 0x20, 0x07, 0x07, 0x70, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x70, 0x70, 0x70,
+	0x10, 0x07, 0x01, 0x03, 0x07, 0x01, 0x03, 0x30, 0x73, 0x00, 0x07, 0x73, 0x00, 0x00, 0x07, 0x01,
+	0x10, 0x07, 0x00, 0x10, 0x00, 0x70, 0x30, 0x07, 0x70, 0x10, 0x00, 0x00, 0x02, 0x22, 0x00, 0x00,
+	0x22, 0x20, 0x20, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x91, 0x90, 0x40, 0x10, 0x90, 0x40, 0x00,
+	0x14, 0x08, 0x40, 0x10, 0x08, 0x00, 0x10, 0x10, 0x00, 0x18, 0x08, 0x00, 0x08, 0x00, 0x08, 0x18,
+	0x08, 0x08, 0x08, 0x08, 0x90, 0x90, 0x07, 0x00, 0x90, 0x07, 0x07, 0x02, 0x08, 0x00, 0x00, 0x08,
+	0x00, 0x10, 0x10, 0x00, 0x17, 0x07, 0x00, 0x01, 0x00, 0x08, 0x11, 0x07, 0x07, 0x07, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x70, 0x07, 0x07, 0x70, 0x77, 0x10, 0x07, 0x07, 0x02,
+	0x07, 0x08, 0x02, 0x20, 0x71, 0x00, 0x07, 0x77, 0x00, 0x00, 0x10, 0x40, 0x07, 0x00, 0x10, 0x07,
+	0x07, 0x03, 0x01, 0x00, 0x00, 0x02, 0x00, 0x40, 0x01, 0x01, 0x03, 0x03, 0x01, 0x01, 0x10, 0x11,
+	0x00, 0x02, 0x22, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x90, 0x40, 0x00, 0x14, 0x08, 0x00, 0x07, 0x00, 0x07, 0x17, 0x08, 0x08, 0x03, 0x08,
+	0x00, 0x07, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x70, 0x07, 0x07, 0x70, 0x77, 0x10, 0x08, 0x09,
+	0x02, 0x08, 0x07, 0x02, 0x20, 0x77, 0x00, 0x01, 0x83, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x07,
+	0x00, 0x00, 0x00, 0x70, 0x07, 0x07, 0x70, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x20, 0x71, 0x00, 0x20, 0x00, 0x70, 0x20, 0x71,
+	0x70, 0x20, 0x70, 0x40, 0x08, 0x08, 0x03, 0x03, 0x07, 0x07, 0x70, 0x77, 0x00, 0x02, 0x22, 0x00,
+	0x00, 0x04, 0x03, 0x30, 0x33, 0x00, 0x70, 0x00, 0x70, 0x70, 0x22, 0x20, 0x20, 0x20, 0x00, 0x08,
+	0x73, 0x00, 0x00, 0x77, 0x70, 0x20, 0x70, 0x00, 0x00, 0x20, 0x00, 0x00, 0x10, 0x10, 0x07, 0x00,
+	0x10, 0x07, 0x07, 0x04, 0x01, 0x00, 0x00, 0x03, 0x00, 0x10, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01,
+	0x10, 0x11, 0x00, 0x03, 0x33, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x10, 0x07, 0x07, 0x07, 0x07, 0x08, 0x01, 0x70, 0x71, 0x00, 0x07, 0x77,
+	0x00, 0x00, 0x01, 0x01, 0x70, 0x71, 0x00, 0x10, 0x00, 0x10, 0x10, 0x71, 0x70, 0x70, 0x70, 0x00,
+	0x07, 0x77, 0x00, 0x00, 0x78, 0x70, 0x20, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x07,
+	0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x71, 0x00, 0x00, 0x71,
+	0x70, 0x10, 0x10, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x98, 0x40,
+	0x00, 0x17, 0x08, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09,
+	0x92, 0x90, 0x00, 0x17, 0x08, 0x00, 0x08, 0x00, 0x08, 0x18, 0x08, 0x07, 0x07, 0x08, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x07, 0x00, 0x08, 0x03, 0x00, 0x00,
+	0x00, 0x70, 0x07, 0x07, 0x00, 0x71, 0x10, 0x40, 0x00, 0x14, 0x08, 0x00, 0x08, 0x00, 0x08, 0x48,
+	0x08, 0x04, 0x03, 0x08, 0x00, 0x01, 0x00, 0x08, 0x03, 0x00, 0x00, 0x00, 0x80, 0x08, 0x03, 0x30,
+	0x73, 0x40, 0x01, 0x04, 0x03, 0x01, 0x01, 0x03, 0x30, 0x11, 0x00, 0x03, 0x33, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09, 0x02, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x09, 0x00, 0x08, 0x03, 0x00,
+	0x00, 0x00, 0x70, 0x01, 0x03, 0x70, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x10, 0x20,
+	0x00, 0x08, 0x00, 0x08, 0x03, 0x00, 0x00, 0x00, 0x70, 0x01, 0x03, 0x30, 0x83, 0x00, 0x00, 0x00,
+	0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x20, 0x08, 0x03, 0x30, 0x88, 0x00,
+	0x70, 0x00, 0x70, 0x70, 0x11, 0x10, 0x30, 0x10, 0x90, 0x10, 0x00, 0x17, 0x08, 0x00, 0x08, 0x00,
+	0x08, 0x98, 0x08, 0x07, 0x07, 0x08, 0x00, 0x01, 0x00, 0x08, 0x01, 0x00, 0x00, 0x00, 0x80, 0x09,
+	0x03, 0x70, 0x73, 0x90, 0x08, 0x07, 0x07, 0x01, 0x08, 0x03, 0x70, 0x81, 0x00, 0x03, 0x77, 0x00,
+	0x00, 0x00, 0x07, 0x00, 0x08, 0x01, 0x00, 0x00, 0x00, 0x70, 0x07, 0x07, 0x00, 0x73, 0x00, 0x00,
+	0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x30, 0x20, 0x07, 0x07, 0x00, 0x78,
+	0x00, 0x70, 0x00, 0x70, 0x70, 0x77, 0x00, 0x00, 0x70, 0x40, 0x01, 0x04, 0x03, 0x01, 0x01, 0x03,
+	0x30, 0x11, 0x00, 0x03, 0x33, 0x00, 0x00, 0x08, 0x01, 0x10, 0x78, 0x00, 0x10, 0x00, 0x80, 0x10,
+	0x73, 0x30, 0x30, 0x70, 0x00, 0x02, 0x22, 0x00, 0x00, 0x22, 0x20, 0x20, 0x20, 0x00, 0x00, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x02,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x07, 0x00,
+	0x07, 0x07, 0x00, 0x00, 0x00, 0x70, 0x07, 0x07, 0x70, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
+	0x00, 0x70, 0x20, 0x00, 0x07, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x70, 0x07, 0x07, 0x70, 0x77,
+	0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x70, 0x20, 0x07, 0x07,
+	0x70, 0x77, 0x00, 0x70, 0x00, 0x70, 0x70, 0x77, 0x70, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x70, 0x00, 0x70, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x70, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x70, 0x00, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00,
+	0x77, 0x70, 0x00, 0x77, 0x07, 0x00, 0x07, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x70, 0x07, 0x07,
+	0x70, 0x77, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x70, 0x20,
+	0x07, 0x07, 0x70, 0x77, 0x00, 0x70, 0x00, 0x70, 0x70, 0x77, 0x70, 0x70, 0x70, 0x00, 0x00, 0x00,
+	0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x70, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x70, 0x00, 0x70, 0x70, 0x00, 0x00, 0x00,
+	0x00, 0x70, 0x70, 0x00, 0x70, 0x07, 0x07, 0x07, 0x70, 0x77, 0x00, 0x70, 0x00, 0x70, 0x70, 0x77,
+	0x70, 0x70, 0x70, 0x00, 0x70, 0x00, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x77, 0x70, 0x00, 0x77,
+	0x00, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x22, 0x02, 0x20, 0x20, 0x02, 0x00, 0x10, 0x40,
+	0x00, 0x17, 0x01, 0x00, 0x01, 0x00, 0x01, 0x11, 0x08, 0x07, 0x07, 0x01, 0x00, 0x08, 0x00, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x80, 0x08, 0x03, 0x70, 0x83, 0x40, 0x08, 0x07, 0x02, 0x01, 0x09, 0x02,
+	0x20, 0x81, 0x00, 0x08, 0x77, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00, 0x10,
+	0x07, 0x07, 0x00, 0x71, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00,
+	0x70, 0x20, 0x07, 0x02, 0x00, 0x71, 0x00, 0x20, 0x00, 0x10, 0x20, 0x77, 0x00, 0x00, 0x70, 0x40,
+	0x01, 0x04, 0x03, 0x01, 0x01, 0x03, 0x30, 0x11, 0x00, 0x02, 0x22, 0x00, 0x00, 0x01, 0x03, 0x30,
+	0x11, 0x00, 0x10, 0x00, 0x10, 0x10, 0x22, 0x20, 0x20, 0x20, 0x00, 0x03, 0x73, 0x00, 0x00, 0x73,
+	0x70, 0x20, 0x10, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00,
+	0x70, 0x08, 0x03, 0x70, 0x83, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
+	0x00, 0x70, 0x20, 0x09, 0x02, 0x20, 0x81, 0x00, 0x20, 0x00, 0x70, 0x20, 0x83, 0x70, 0x20, 0x10,
+	0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x70, 0x20, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x10, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x72, 0x20, 0x00, 0x10, 0x07, 0x01, 0x03, 0x30, 0x11, 0x00, 0x70, 0x00,
+	0x70, 0x70, 0x22, 0x20, 0x20, 0x20, 0x00, 0x30, 0x00, 0x10, 0x30, 0x00, 0x00, 0x00, 0x00, 0x27,
+	0x20, 0x00, 0x22, 0x02, 0x83, 0x30, 0x20, 0x10, 0x70, 0x20, 0x00, 0x72, 0x07, 0x20, 0x20, 0x02,
+	0x00, 0x10, 0x08, 0x07, 0x07, 0x01, 0x08, 0x01, 0x70, 0x11, 0x00, 0x03, 0x77, 0x00, 0x00, 0x01,
+	0x01, 0x70, 0x11, 0x00, 0x10, 0x00, 0x10, 0x10, 0x33, 0x70, 0x70, 0x30, 0x00, 0x08, 0x77, 0x00,
+	0x00, 0x73, 0x70, 0x20, 0x10, 0x00, 0x00, 0x70, 0x00, 0x00, 0x07, 0x07, 0x00, 0x71, 0x00, 0x70,
+	0x00, 0x10, 0x10, 0x77, 0x00, 0x00, 0x70, 0x00, 0x70, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00,
+	0x71, 0x70, 0x00, 0x30, 0x07, 0x77, 0x00, 0x00, 0x70, 0x70, 0x20, 0x00, 0x10, 0x07, 0x70, 0x00,
+	0x00, 0x00, 0x00, 0x03, 0x73, 0x00, 0x00, 0x71, 0x70, 0x30, 0x10, 0x00, 0x00, 0x20, 0x00, 0x00,
+	0x11, 0x10, 0x30, 0x10, 0x10, 0x10, 0x00, 0x11, 0x01, 0x20, 0x20, 0x02, 0x00, 0x00, 0x00, 0x20,
+	0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x10, 0x10, 0x90, 0x90,
+	0x10, 0x00, 0x91, 0x08, 0x10, 0x10, 0x01, 0x00, 0x90, 0x10, 0x00, 0x91, 0x07, 0x00, 0x08, 0x00,
+	0x08, 0x18, 0x07, 0x01, 0x01, 0x07, 0x90, 0x10, 0x07, 0x00, 0x90, 0x07, 0x07, 0x04, 0x08, 0x00,
+	0x00, 0x04, 0x00, 0x90, 0x10, 0x00, 0x91, 0x07, 0x00, 0x07, 0x00, 0x07, 0x17, 0x07, 0x01, 0x01,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x70, 0x07, 0x07, 0x70, 0x77, 0x10, 0x07,
+	0x08, 0x01, 0x07, 0x07, 0x07, 0x70, 0x77, 0x00, 0x07, 0x71, 0x00, 0x00, 0x10, 0x10, 0x07, 0x00,
+	0x10, 0x07, 0x07, 0x01, 0x02, 0x00, 0x00, 0x01, 0x00, 0x40, 0x07, 0x08, 0x01, 0x02, 0x01, 0x03,
+	0x10, 0x22, 0x00, 0x07, 0x71, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x90, 0x10, 0x00, 0x91, 0x08, 0x00, 0x07, 0x00, 0x07, 0x17, 0x08, 0x01,
+	0x01, 0x08, 0x00, 0x07, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x70, 0x07, 0x07, 0x70, 0x77, 0x10,
+	0x08, 0x08, 0x01, 0x01, 0x07, 0x07, 0x70, 0x77, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x07, 0x00,
+	0x07, 0x07, 0x00, 0x00, 0x00, 0x70, 0x07, 0x07, 0x70, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x01, 0x10, 0x78, 0x00, 0x70, 0x00, 0x70,
+	0x70, 0x71, 0x10, 0x10, 0x70, 0x40, 0x01, 0x08, 0x01, 0x02, 0x07, 0x07, 0x70, 0x22, 0x00, 0x03,
+	0x11, 0x00, 0x00, 0x04, 0x03, 0x10, 0x22, 0x00, 0x70, 0x00, 0x20, 0x20, 0x73, 0x10, 0x30, 0x20,
+	0x00, 0x01, 0x78, 0x00, 0x00, 0x77, 0x70, 0x70, 0x20, 0x00, 0x00, 0x10, 0x00, 0x00, 0x90, 0x10,
+	0x07, 0x00, 0x90, 0x07, 0x07, 0x04, 0x08, 0x00, 0x00, 0x04, 0x00, 0x10, 0x07, 0x08, 0x01, 0x07,
+	0x08, 0x01, 0x10, 0x71, 0x00, 0x07, 0x71, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x07, 0x08, 0x01, 0x07, 0x07, 0x07, 0x70, 0x77, 0x00,
+	0x07, 0x71, 0x00, 0x00, 0x08, 0x01, 0x10, 0x78, 0x00, 0x70, 0x00, 0x70, 0x70, 0x71, 0x10, 0x10,
+	0x70, 0x00, 0x07, 0x78, 0x00, 0x00, 0x77, 0x70, 0x70, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
+	0x00, 0x07, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x78, 0x00,
+	0x00, 0x71, 0x70, 0x10, 0x20, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x10, 0x00, 0x91, 0x07, 0x00, 0x07, 0x00, 0x07,
+	0x17, 0x07, 0x01, 0x01, 0x07, 0x00, 0x08, 0x00, 0x07, 0x03, 0x00, 0x00, 0x00, 0x70, 0x07, 0x04,
+	0x10, 0x07, 0x10, 0x08, 0x08, 0x01, 0x08, 0x07, 0x07, 0x70, 0x77, 0x00, 0x01, 0x11, 0x00, 0x00,
+	0x00, 0x07, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x08, 0x01, 0x10, 0x78, 0x00, 0x00, 0x00,
+	0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x70, 0x20, 0x07, 0x07, 0x70, 0x77, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x71, 0x10, 0x10, 0x70, 0x10, 0x07, 0x08, 0x01, 0x02, 0x01, 0x03, 0x10,
+	0x22, 0x00, 0x07, 0x71, 0x00, 0x00, 0x07, 0x03, 0x10, 0x02, 0x00, 0x30, 0x00, 0x20, 0x20, 0x07,
+	0x70, 0x10, 0x00, 0x00, 0x03, 0x71, 0x00, 0x00, 0x73, 0x70, 0x30, 0x20, 0x00, 0x00, 0x10, 0x00,
+	0x00, 0x00, 0x08, 0x00, 0x08, 0x03, 0x00, 0x00, 0x00, 0x70, 0x08, 0x01, 0x10, 0x73, 0x00, 0x00,
+	0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x70, 0x20, 0x08, 0x08, 0x80, 0x81,
+	0x00, 0x70, 0x00, 0x70, 0x70, 0x11, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x70, 0x00, 0x70, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00,
+	0x11, 0x07, 0x01, 0x03, 0x10, 0x22, 0x00, 0x70, 0x00, 0x20, 0x20, 0x71, 0x10, 0x10, 0x20, 0x00,
+	0x30, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x72, 0x30, 0x00, 0x21, 0x00, 0x11, 0x80, 0x10,
+	0x20, 0x70, 0x70, 0x00, 0x27, 0x02, 0x10, 0x10, 0x01, 0x00, 0x90, 0x07, 0x08, 0x01, 0x07, 0x07,
+	0x07, 0x70, 0x77, 0x00, 0x07, 0x71, 0x00, 0x00, 0x07, 0x04, 0x10, 0x07, 0x00, 0x70, 0x00, 0x70,
+	0x70, 0x07, 0x70, 0x10, 0x00, 0x00, 0x08, 0x71, 0x00, 0x00, 0x77, 0x70, 0x70, 0x70, 0x00, 0x00,
+	0x30, 0x00, 0x00, 0x07, 0x07, 0x70, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x10, 0x10, 0x70,
+	0x00, 0x70, 0x00, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x70, 0x30, 0x00, 0x71, 0x00, 0x77, 0x70,
+	0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x10, 0x07, 0x00, 0x00, 0x07, 0x71, 0x00, 0x00,
+	0x73, 0x70, 0x30, 0x20, 0x00, 0x00, 0x70, 0x00, 0x00, 0x07, 0x70, 0x10, 0x00, 0x70, 0x30, 0x00,
+	0x21, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x07, 0x00, 0x90, 0x07, 0x07, 0x03, 0x03, 0x00, 0x00, 0x03,
+	0x00, 0x40, 0x04, 0x09, 0x01, 0x03, 0x09, 0x01, 0x10, 0x33, 0x00, 0x03, 0x33, 0x00, 0x00, 0x00,
+	0x00, 0x07, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x07, 0x01, 0x03,
+	0x07, 0x08, 0x03, 0x30, 0x78, 0x00, 0x07, 0x71, 0x00, 0x00, 0x07, 0x07, 0x70, 0x77, 0x00, 0x70,
+	0x00, 0x70, 0x70, 0x77, 0x70, 0x70, 0x70, 0x00, 0x07, 0x73, 0x00, 0x00, 0x73, 0x70, 0x20, 0x70,
+	0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x03, 0x73, 0x00, 0x00, 0x73, 0x70, 0x10, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x08, 0x09,
+	0x03, 0x03, 0x07, 0x07, 0x70, 0x77, 0x00, 0x03, 0x33, 0x00, 0x00, 0x07, 0x07, 0x70, 0x77, 0x00,
+	0x70, 0x00, 0x70, 0x70, 0x77, 0x70, 0x70, 0x70, 0x00, 0x08, 0x73, 0x00, 0x00, 0x77, 0x70, 0x20,
+	0x70, 0x00, 0x00, 0x30, 0x00, 0x00, 0x07, 0x07, 0x70, 0x77, 0x00, 0x70, 0x00, 0x70, 0x70, 0x77,
+	0x70, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x73, 0x30, 0x20, 0x70, 0x70, 0x20, 0x00, 0x72, 0x07, 0x70, 0x30, 0x07, 0x00, 0x00, 0x03,
+	0x73, 0x00, 0x00, 0x77, 0x70, 0x70, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x33, 0x30, 0x30, 0x20,
+	0x70, 0x70, 0x00, 0x27, 0x02, 0x20, 0x20, 0x02, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x70,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x71, 0x00, 0x00, 0x71, 0x70, 0x10, 0x30, 0x00, 0x00, 0x30,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x07, 0x71, 0x00, 0x00, 0x71, 0x70, 0x30, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x71, 0x10, 0x10,
+	0x70, 0x10, 0x10, 0x00, 0x11, 0x07, 0x70, 0x10, 0x07, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70,
+	0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x90, 0x00, 0x90, 0x90, 0x00, 0x00, 0x00, 0x00, 0x97, 0x40, 0x00, 0x48, 0x07, 0x00, 0x00,
+	0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x92, 0x90, 0x00, 0x99, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x17, 0x07, 0x08, 0x01, 0x07, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x20, 0x00, 0x08, 0x00, 0x07, 0x03, 0x00, 0x00, 0x00, 0x70, 0x07, 0x03, 0x70,
+	0x07, 0x10, 0x10, 0x00, 0x11, 0x01, 0x00, 0x07, 0x00, 0x07, 0x17, 0x08, 0x01, 0x01, 0x03, 0x00,
+	0x01, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00, 0x70, 0x08, 0x03, 0x10, 0x73, 0x10, 0x01, 0x01, 0x03,
+	0x03, 0x07, 0x07, 0x70, 0x77, 0x00, 0x03, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x07, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03,
+	0x10, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x70, 0x20, 0x00, 0x07, 0x00, 0x07, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x10, 0x33, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x30, 0x00, 0x30, 0x20, 0x07, 0x07, 0x70, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+	0x10, 0x10, 0x30, 0x90, 0x10, 0x00, 0x98, 0x07, 0x00, 0x08, 0x00, 0x08, 0x98, 0x07, 0x08, 0x08,
+	0x07, 0x00, 0x01, 0x00, 0x08, 0x01, 0x00, 0x00, 0x00, 0x80, 0x08, 0x01, 0x80, 0x78, 0x90, 0x07,
+	0x08, 0x03, 0x07, 0x08, 0x03, 0x30, 0x78, 0x00, 0x07, 0x78, 0x00, 0x00, 0x00, 0x08, 0x00, 0x07,
+	0x01, 0x00, 0x00, 0x00, 0x70, 0x07, 0x01, 0x70, 0x07, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x00, 0x70, 0x20, 0x07, 0x08, 0x70, 0x07, 0x00, 0x70, 0x00, 0x70, 0x70,
+	0x07, 0x70, 0x70, 0x00, 0x10, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x10, 0x33, 0x00, 0x03, 0x33,
+	0x00, 0x00, 0x08, 0x01, 0x10, 0x71, 0x00, 0x10, 0x00, 0x10, 0x10, 0x78, 0x80, 0x10, 0x70, 0x00,
+	0x02, 0x22, 0x00, 0x00, 0x22, 0x20, 0x20, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x07, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00,
+	0x70, 0x07, 0x07, 0x70, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x70, 0x20, 0x00, 0x07,
+	0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x70, 0x07, 0x07, 0x70, 0x77, 0x00, 0x00, 0x00, 0x00, 0x70,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x70, 0x20, 0x07, 0x07, 0x70, 0x77, 0x00, 0x70, 0x00,
+	0x70, 0x70, 0x77, 0x70, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x70, 0x20, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x70, 0x00, 0x70, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x02, 0x70, 0x00, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x00, 0x77, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x70, 0x07, 0x07, 0x70, 0x77, 0x00, 0x00, 0x00,
+	0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x70, 0x20, 0x07, 0x07, 0x70, 0x77, 0x00,
+	0x70, 0x00, 0x70, 0x70, 0x77, 0x70, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x70, 0x00, 0x70, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x02, 0x70, 0x00, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x00, 0x77,
+	0x00, 0x07, 0x07, 0x70, 0x77, 0x00, 0x70, 0x00, 0x70, 0x70, 0x77, 0x70, 0x70, 0x70, 0x00, 0x70,
+	0x00, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x77, 0x70, 0x00, 0x77, 0x00, 0x22, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x00, 0x22, 0x02, 0x20, 0x20, 0x02, 0x00, 0x90, 0x40, 0x00, 0x11, 0x07, 0x00, 0x07,
+	0x00, 0x07, 0x47, 0x07, 0x08, 0x03, 0x07, 0x00, 0x08, 0x00, 0x08, 0x01, 0x00, 0x00, 0x00, 0x70,
+	0x08, 0x03, 0x80, 0x73, 0x40, 0x07, 0x08, 0x02, 0x07, 0x07, 0x02, 0x20, 0x77, 0x00, 0x07, 0x73,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x03, 0x00, 0x00, 0x00, 0x70, 0x07, 0x03, 0x70, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x70, 0x20, 0x07, 0x02, 0x20,
+	0x07, 0x00, 0x20, 0x00, 0x70, 0x20, 0x07, 0x70, 0x20, 0x00, 0x10, 0x08, 0x08, 0x03, 0x03, 0x07,
+	0x07, 0x70, 0x77, 0x00, 0x02, 0x22, 0x00, 0x00, 0x01, 0x01, 0x10, 0x33, 0x00, 0x70, 0x00, 0x70,
+	0x70, 0x22, 0x20, 0x20, 0x20, 0x00, 0x03, 0x73, 0x00, 0x00, 0x77, 0x70, 0x20, 0x70, 0x00, 0x00,
+	0x20, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x08, 0x03, 0x30, 0x73,
+	0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x70, 0x20, 0x07, 0x02,
+	0x20, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x30, 0x20, 0x70, 0x00, 0x00, 0x00, 0x00, 0x70,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x70, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x70, 0x20, 0x00, 0x00, 0x00, 0x00, 0x70,
+	0x20, 0x00, 0x72, 0x00, 0x07, 0x07, 0x70, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x20, 0x20,
+	0x20, 0x00, 0x70, 0x00, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x22, 0x02, 0x77,
+	0x70, 0x20, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x02, 0x00, 0x10, 0x07, 0x08, 0x01,
+	0x07, 0x08, 0x01, 0x10, 0x71, 0x00, 0x07, 0x78, 0x00, 0x00, 0x01, 0x01, 0x10, 0x71, 0x00, 0x10,
+	0x00, 0x10, 0x10, 0x71, 0x80, 0x10, 0x70, 0x00, 0x07, 0x73, 0x00, 0x00, 0x73, 0x70, 0x20, 0x70,
+	0x00, 0x00, 0x70, 0x00, 0x00, 0x07, 0x01, 0x70, 0x07, 0x00, 0x10, 0x00, 0x70, 0x10, 0x07, 0x70,
+	0x70, 0x00, 0x00, 0x10, 0x00, 0x70, 0x10, 0x00, 0x00, 0x00, 0x00, 0x71, 0x10, 0x00, 0x77, 0x00,
+	0x07, 0x70, 0x20, 0x00, 0x70, 0x20, 0x00, 0x72, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x03, 0x73,
+	0x00, 0x00, 0x71, 0x70, 0x10, 0x30, 0x00, 0x00, 0x20, 0x00, 0x00, 0x11, 0x10, 0x10, 0x30, 0x10,
+	0x10, 0x00, 0x11, 0x01, 0x20, 0x20, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x20, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x07, 0x00, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x07, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x70, 0x07, 0x07, 0x70, 0x77, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x70, 0x00, 0x70, 0x20, 0x00, 0x07, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x70,
+	0x07, 0x07, 0x70, 0x77, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00,
+	0x70, 0x20, 0x07, 0x07, 0x70, 0x77, 0x00, 0x70, 0x00, 0x70, 0x70, 0x77, 0x70, 0x70, 0x70, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x70, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x70, 0x20, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x70, 0x00, 0x70, 0x70,
+	0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x00, 0x77, 0x07, 0x00, 0x07, 0x00, 0x07, 0x07, 0x00, 0x00,
+	0x00, 0x70, 0x07, 0x07, 0x70, 0x77, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x70, 0x00, 0x70, 0x20, 0x07, 0x07, 0x70, 0x77, 0x00, 0x70, 0x00, 0x70, 0x70, 0x77, 0x70, 0x70,
+	0x70, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x70, 0x20, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x70, 0x00, 0x70,
+	0x70, 0x00, 0x00, 0x00, 0x00, 0x77, 0x70, 0x00, 0x70, 0x00, 0x07, 0x07, 0x70, 0x77, 0x00, 0x70,
+	0x00, 0x70, 0x70, 0x77, 0x70, 0x70, 0x70, 0x00, 0x70, 0x00, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00,
+	0x77, 0x70, 0x00, 0x77, 0x07, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x22, 0x02, 0x20, 0x20,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00, 0x70, 0x08, 0x03, 0x70, 0x73, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x20, 0x04, 0x02, 0x20, 0x74, 0x00, 0x20,
+	0x00, 0x70, 0x20, 0x73, 0x70, 0x20, 0x70, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x70, 0x00, 0x70, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x02, 0x20, 0x00, 0x70, 0x20, 0x00, 0x00, 0x00, 0x00, 0x72, 0x20, 0x00, 0x70, 0x00,
+	0x01, 0x03, 0x30, 0x11, 0x00, 0x70, 0x00, 0x70, 0x70, 0x22, 0x20, 0x20, 0x20, 0x00, 0x10, 0x00,
+	0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x27, 0x20, 0x00, 0x22, 0x02, 0x33, 0x30, 0x20, 0x30, 0x70,
+	0x20, 0x00, 0x72, 0x07, 0x20, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x30, 0x00, 0x30, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x70, 0x20, 0x00, 0x00, 0x00, 0x00, 0x30, 0x20, 0x00, 0x32,
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07, 0x02, 0x70, 0x00, 0x70, 0x70, 0x00, 0x00,
+	0x00, 0x00, 0x20, 0x20, 0x00, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x02, 0x00, 0x02, 0x72, 0x20, 0x00, 0x72, 0x07, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x02,
+	0x02, 0x02, 0x08, 0x04, 0x70, 0x74, 0x00, 0x10, 0x00, 0x10, 0x10, 0x78, 0x70, 0x70, 0x70, 0x00,
+	0x10, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x81, 0x30, 0x00, 0x37, 0x07, 0x73, 0x70, 0x20,
+	0x70, 0x30, 0x20, 0x00, 0x32, 0x07, 0x70, 0x70, 0x07, 0x00, 0x00, 0x70, 0x00, 0x70, 0x30, 0x00,
+	0x00, 0x00, 0x00, 0x71, 0x70, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x07, 0x00, 0x07, 0x72, 0x20, 0x00, 0x70, 0x00, 0x00, 0x02, 0x00, 0x07, 0x72, 0x00,
+	0x00, 0x00, 0x00, 0x33, 0x30, 0x30, 0x30, 0x10, 0x10, 0x00, 0x11, 0x01, 0x20, 0x20, 0x02, 0x00,
+	0x10, 0x10, 0x00, 0x11, 0x01, 0x00, 0x01, 0x00, 0x01, 0x21, 0x02, 0x02, 0x02, 0x02, 0x20, 0x20,
+	0x02, 0x00, 0x20, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x02, 0x00, 0x90, 0x10, 0x00, 0x91, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x17, 0x07, 0x01, 0x01, 0x07, 0x00, 0x08, 0x00, 0x08, 0x03, 0x00, 0x00,
+	0x00, 0x70, 0x08, 0x01, 0x10, 0x73, 0x90, 0x07, 0x08, 0x01, 0x07, 0x07, 0x07, 0x70, 0x77, 0x00,
+	0x07, 0x71, 0x00, 0x00, 0x00, 0x08, 0x00, 0x07, 0x08, 0x00, 0x00, 0x00, 0x70, 0x07, 0x01, 0x10,
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x70, 0x20, 0x07,
+	0x01, 0x10, 0x07, 0x00, 0x70, 0x00, 0x70, 0x70, 0x07, 0x70, 0x10, 0x00, 0x10, 0x01, 0x08, 0x01,
+	0x02, 0x07, 0x07, 0x70, 0x22, 0x00, 0x03, 0x11, 0x00, 0x00, 0x01, 0x01, 0x10, 0x22, 0x00, 0x70,
+	0x00, 0x20, 0x20, 0x73, 0x10, 0x10, 0x20, 0x00, 0x03, 0x71, 0x00, 0x00, 0x77, 0x70, 0x70, 0x20,
+	0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04,
+	0x10, 0x73, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x70, 0x20,
+	0x07, 0x07, 0x70, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x10, 0x10, 0x70, 0x00, 0x00, 0x00,
+	0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x70, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x70, 0x70, 0x00, 0x00, 0x00,
+	0x00, 0x70, 0x30, 0x00, 0x71, 0x00, 0x07, 0x07, 0x70, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33,
+	0x10, 0x10, 0x20, 0x00, 0x70, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x21,
+	0x02, 0x77, 0x70, 0x70, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x10, 0x01, 0x00, 0x10, 0x07,
+	0x08, 0x01, 0x07, 0x08, 0x01, 0x10, 0x78, 0x00, 0x07, 0x71, 0x00, 0x00, 0x08, 0x01, 0x10, 0x71,
+	0x00, 0x10, 0x00, 0x80, 0x10, 0x78, 0x80, 0x10, 0x70, 0x00, 0x07, 0x71, 0x00, 0x00, 0x78, 0x70,
+	0x30, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x07, 0x01, 0x10, 0x07, 0x00, 0x70, 0x00, 0x70, 0x70,
+	0x07, 0x70, 0x10, 0x00, 0x00, 0x10, 0x00, 0x70, 0x10, 0x00, 0x00, 0x00, 0x00, 0x77, 0x10, 0x00,
+	0x71, 0x00, 0x07, 0x70, 0x10, 0x00, 0x70, 0x70, 0x00, 0x77, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
+	0x03, 0x71, 0x00, 0x00, 0x73, 0x70, 0x10, 0x20, 0x00, 0x00, 0x30, 0x00, 0x00, 0x71, 0x80, 0x10,
+	0x20, 0x10, 0x10, 0x00, 0x21, 0x02, 0x70, 0x10, 0x07, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20,
+	0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x03, 0x00, 0x00, 0x00,
+	0x70, 0x08, 0x01, 0x10, 0x73, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+	0x00, 0x70, 0x20, 0x08, 0x08, 0x80, 0x78, 0x00, 0x70, 0x00, 0x70, 0x70, 0x71, 0x10, 0x10, 0x70,
+	0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x70, 0x20, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x70, 0x00, 0x70, 0x70,
+	0x00, 0x00, 0x00, 0x00, 0x70, 0x10, 0x00, 0x71, 0x00, 0x01, 0x01, 0x10, 0x22, 0x00, 0x70, 0x00,
+	0x20, 0x20, 0x71, 0x10, 0x10, 0x20, 0x00, 0x10, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x72,
+	0x10, 0x00, 0x21, 0x00, 0x33, 0x10, 0x10, 0x20, 0x70, 0x70, 0x00, 0x27, 0x02, 0x30, 0x10, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x30, 0x20, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x70, 0x00, 0x70,
+	0x70, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x31, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x07, 0x02, 0x70, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x21, 0x02,
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x72, 0x70, 0x00,
+	0x27, 0x02, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x01, 0x01, 0x02, 0x08, 0x01, 0x10, 0x78, 0x00,
+	0x70, 0x00, 0x70, 0x70, 0x78, 0x80, 0x10, 0x70, 0x00, 0x10, 0x00, 0x70, 0x30, 0x00, 0x00, 0x00,
+	0x00, 0x77, 0x10, 0x00, 0x71, 0x00, 0x78, 0x80, 0x10, 0x70, 0x70, 0x70, 0x00, 0x77, 0x07, 0x70,
+	0x10, 0x07, 0x00, 0x00, 0x70, 0x00, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x70, 0x10, 0x00, 0x71,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x72, 0x70,
+	0x00, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x07, 0x01, 0x00, 0x73, 0x10, 0x10, 0x20,
+	0x30, 0x30, 0x00, 0x21, 0x02, 0x70, 0x10, 0x07, 0x00, 0x70, 0x10, 0x00, 0x21, 0x00, 0x00, 0x01,
+	0x00, 0x02, 0x72, 0x00, 0x07, 0x01, 0x00, 0x20, 0x20, 0x02, 0x00, 0x20, 0x02, 0x02, 0x02, 0x02,
+	0x00, 0x00, 0x02, 0x00, 0x90, 0x07, 0x08, 0x01, 0x07, 0x07, 0x07, 0x70, 0x77, 0x00, 0x07, 0x71,
+	0x00, 0x00, 0x08, 0x08, 0x80, 0x78, 0x00, 0x70, 0x00, 0x70, 0x70, 0x78, 0x80, 0x10, 0x70, 0x00,
+	0x07, 0x78, 0x00, 0x00, 0x77, 0x70, 0x20, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x07, 0x01, 0x10,
+	0x07, 0x00, 0x70, 0x00, 0x70, 0x70, 0x07, 0x70, 0x10, 0x00, 0x00, 0x70, 0x00, 0x70, 0x70, 0x00,
+	0x00, 0x00, 0x00, 0x77, 0x70, 0x00, 0x77, 0x00, 0x07, 0x70, 0x20, 0x00, 0x70, 0x20, 0x00, 0x72,
+	0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x03, 0x78, 0x00, 0x00, 0x77, 0x70, 0x70, 0x20, 0x00, 0x00,
+	0x20, 0x00, 0x00, 0x33, 0x80, 0x10, 0x20, 0x70, 0x70, 0x00, 0x27, 0x02, 0x20, 0x20, 0x02, 0x00,
+	0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07,
+	0x70, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x80, 0x30, 0x70, 0x00, 0x70, 0x00, 0x70, 0x70,
+	0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x00, 0x77, 0x07, 0x77, 0x70, 0x20, 0x70, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x70, 0x30, 0x07, 0x00, 0x00, 0x70, 0x00, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x70,
+	0x70, 0x00, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x70, 0x20, 0x00, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x07, 0x02, 0x00, 0x77,
+	0x70, 0x70, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x02, 0x00, 0x70, 0x70, 0x00, 0x27,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x02, 0x02, 0x02, 0x70, 0x70, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x07, 0x78, 0x00, 0x00, 0x78, 0x70, 0x10, 0x70,
+	0x00, 0x00, 0x70, 0x00, 0x00, 0x71, 0x80, 0x10, 0x70, 0x80, 0x10, 0x00, 0x11, 0x07, 0x70, 0x10,
+	0x07, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x07, 0x70, 0x10, 0x00, 0x70, 0x10, 0x00, 0x71, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x10, 0x00,
+	0x71, 0x00, 0x00, 0x01, 0x00, 0x07, 0x71, 0x00, 0x07, 0x01, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70,
+	0x00, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x70, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x10, 0x07, 0x00, 0x10, 0x07, 0x07, 0x01, 0x02, 0x00,
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x91, 0x90, 0x10, 0x10, 0x90, 0x40, 0x00, 0x18, 0x08, 0x40, 0x40, 0x04, 0x00, 0x90, 0x10,
+	0x00, 0x18, 0x07, 0x00, 0x08, 0x00, 0x08, 0x48, 0x07, 0x04, 0x03, 0x07, 0x10, 0x10, 0x07, 0x00,
+	0x10, 0x07, 0x07, 0x03, 0x01, 0x00, 0x00, 0x04, 0x00, 0x10, 0x10, 0x00, 0x17, 0x08, 0x00, 0x07,
+	0x00, 0x07, 0x17, 0x01, 0x07, 0x07, 0x01, 0x00, 0x07, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x70,
+	0x07, 0x07, 0x70, 0x77, 0x10, 0x08, 0x07, 0x07, 0x01, 0x07, 0x07, 0x70, 0x77, 0x00, 0x01, 0x77,
+	0x00, 0x00, 0x10, 0x40, 0x07, 0x00, 0x10, 0x07, 0x07, 0x02, 0x01, 0x00, 0x00, 0x03, 0x00, 0x40,
+	0x07, 0x08, 0x02, 0x07, 0x08, 0x02, 0x20, 0x73, 0x00, 0x07, 0x73, 0x00, 0x00, 0x00, 0x00, 0x07,
+	0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x18, 0x08, 0x00,
+	0x08, 0x00, 0x08, 0x18, 0x08, 0x08, 0x08, 0x08, 0x00, 0x07, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00,
+	0x70, 0x07, 0x07, 0x70, 0x77, 0x10, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x30, 0x14, 0x00, 0x01,
+	0x11, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x70, 0x07, 0x07, 0x70, 0x77,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x70, 0x11, 0x00, 0x70, 0x00, 0x70, 0x70, 0x11, 0x70, 0x70, 0x10, 0x40, 0x01, 0x01, 0x02, 0x01,
+	0x01, 0x02, 0x20, 0x13, 0x00, 0x01, 0x13, 0x00, 0x00, 0x04, 0x02, 0x20, 0x73, 0x00, 0x20, 0x00,
+	0x30, 0x20, 0x73, 0x30, 0x20, 0x70, 0x00, 0x01, 0x71, 0x00, 0x00, 0x71, 0x70, 0x20, 0x10, 0x00,
+	0x00, 0x10, 0x00, 0x00, 0x90, 0x90, 0x07, 0x00, 0x90, 0x07, 0x07, 0x08, 0x08, 0x00, 0x00, 0x02,
+	0x00, 0x10, 0x07, 0x09, 0x03, 0x07, 0x08, 0x01, 0x80, 0x78, 0x00, 0x02, 0x22, 0x00, 0x00, 0x00,
+	0x00, 0x07, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x07, 0x07,
+	0x01, 0x07, 0x07, 0x70, 0x77, 0x00, 0x02, 0x22, 0x00, 0x00, 0x01, 0x01, 0x70, 0x71, 0x00, 0x70,
+	0x00, 0x70, 0x70, 0x22, 0x20, 0x20, 0x20, 0x00, 0x08, 0x77, 0x00, 0x00, 0x77, 0x70, 0x70, 0x70,
+	0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x07, 0x73, 0x00, 0x00, 0x78, 0x70, 0x20, 0x70, 0x00, 0x00, 0x20, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x40, 0x00,
+	0x18, 0x07, 0x00, 0x07, 0x00, 0x07, 0x47, 0x07, 0x01, 0x03, 0x07, 0x00, 0x08, 0x00, 0x07, 0x03,
+	0x00, 0x00, 0x00, 0x70, 0x07, 0x03, 0x30, 0x07, 0x10, 0x08, 0x08, 0x08, 0x01, 0x07, 0x07, 0x70,
+	0x77, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0x03, 0x70, 0x73, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x70,
+	0x20, 0x07, 0x07, 0x70, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x70, 0x70, 0x10, 0x10, 0x07,
+	0x08, 0x02, 0x07, 0x08, 0x02, 0x20, 0x73, 0x00, 0x07, 0x73, 0x00, 0x00, 0x07, 0x02, 0x20, 0x07,
+	0x00, 0x20, 0x00, 0x70, 0x20, 0x07, 0x70, 0x20, 0x00, 0x00, 0x01, 0x73, 0x00, 0x00, 0x73, 0x70,
+	0x20, 0x30, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x03, 0x00, 0x00, 0x00, 0x70,
+	0x08, 0x03, 0x80, 0x71, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00,
+	0x70, 0x20, 0x01, 0x01, 0x80, 0x11, 0x00, 0x70, 0x00, 0x70, 0x70, 0x11, 0x10, 0x10, 0x10, 0x00,
+	0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x70, 0x20, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x70, 0x70, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x17, 0x01, 0x01, 0x02, 0x20, 0x73, 0x00, 0x20, 0x00, 0x30,
+	0x20, 0x71, 0x10, 0x20, 0x70, 0x00, 0x20, 0x00, 0x70, 0x20, 0x00, 0x00, 0x00, 0x00, 0x72, 0x20,
+	0x00, 0x72, 0x00, 0x11, 0x10, 0x20, 0x10, 0x10, 0x20, 0x00, 0x32, 0x01, 0x10, 0x10, 0x01, 0x00,
+	0x40, 0x07, 0x08, 0x03, 0x07, 0x07, 0x07, 0x70, 0x77, 0x00, 0x02, 0x22, 0x00, 0x00, 0x07, 0x03,
+	0x30, 0x07, 0x00, 0x70, 0x00, 0x70, 0x70, 0x02, 0x20, 0x20, 0x00, 0x00, 0x03, 0x73, 0x00, 0x00,
+	0x77, 0x70, 0x70, 0x70, 0x00, 0x00, 0x20, 0x00, 0x00, 0x07, 0x07, 0x70, 0x77, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x22, 0x20, 0x20, 0x20, 0x00, 0x70, 0x00, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x20,
+	0x20, 0x00, 0x22, 0x00, 0x77, 0x70, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x02,
+	0x00, 0x00, 0x07, 0x73, 0x00, 0x00, 0x73, 0x70, 0x20, 0x70, 0x00, 0x00, 0x20, 0x00, 0x00, 0x07,
+	0x70, 0x20, 0x00, 0x70, 0x20, 0x00, 0x72, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
+	0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x07, 0x00, 0x40, 0x07,
+	0x07, 0x03, 0x01, 0x00, 0x00, 0x03, 0x00, 0x40, 0x04, 0x04, 0x03, 0x04, 0x01, 0x03, 0x30, 0x11,
+	0x00, 0x03, 0x33, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x10, 0x01, 0x07, 0x07, 0x01, 0x01, 0x03, 0x70, 0x11, 0x00, 0x03, 0x77, 0x00, 0x00,
+	0x07, 0x07, 0x70, 0x77, 0x00, 0x70, 0x00, 0x70, 0x70, 0x77, 0x70, 0x70, 0x70, 0x00, 0x01, 0x77,
+	0x00, 0x00, 0x73, 0x70, 0x20, 0x10, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
+	0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x73, 0x00, 0x00, 0x73, 0x70, 0x20,
+	0x10, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x40, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x30, 0x14, 0x00, 0x03, 0x33, 0x00,
+	0x00, 0x07, 0x07, 0x70, 0x77, 0x00, 0x70, 0x00, 0x70, 0x70, 0x77, 0x70, 0x70, 0x70, 0x00, 0x01,
+	0x73, 0x00, 0x00, 0x73, 0x70, 0x20, 0x10, 0x00, 0x00, 0x30, 0x00, 0x00, 0x07, 0x07, 0x70, 0x77,
+	0x00, 0x70, 0x00, 0x70, 0x70, 0x77, 0x70, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x70, 0x20, 0x10, 0x30, 0x20, 0x00, 0x32, 0x01,
+	0x10, 0x70, 0x07, 0x00, 0x00, 0x03, 0x73, 0x00, 0x00, 0x73, 0x70, 0x20, 0x10, 0x00, 0x00, 0x20,
+	0x00, 0x00, 0x33, 0x30, 0x20, 0x30, 0x30, 0x20, 0x00, 0x32, 0x01, 0x20, 0x20, 0x02, 0x00, 0x00,
+	0x00, 0x70, 0x00, 0x00, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+	0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x73, 0x00, 0x00, 0x71,
+	0x70, 0x30, 0x10, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x77, 0x00, 0x00, 0x71, 0x70, 0x70, 0x10, 0x00, 0x00,
+	0x20, 0x00, 0x00, 0x33, 0x70, 0x70, 0x30, 0x10, 0x10, 0x00, 0x17, 0x01, 0x20, 0x20, 0x02, 0x00,
+	0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00,
+	0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x17, 0x01, 0x00, 0x08, 0x00, 0x01, 0x41,
+	0x01, 0x07, 0x07, 0x01, 0x00, 0x08, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00, 0x80, 0x04, 0x03, 0x70,
+	0x73, 0x10, 0x08, 0x07, 0x07, 0x01, 0x08, 0x03, 0x70, 0x11, 0x00, 0x01, 0x77, 0x00, 0x00, 0x00,
+	0x07, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x70, 0x07, 0x07, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00,
+	0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x70, 0x20, 0x07, 0x07, 0x00, 0x11, 0x00, 0x70,
+	0x00, 0x70, 0x70, 0x77, 0x00, 0x00, 0x10, 0x40, 0x01, 0x04, 0x02, 0x01, 0x01, 0x02, 0x20, 0x11,
+	0x00, 0x03, 0x33, 0x00, 0x00, 0x01, 0x02, 0x20, 0x71, 0x00, 0x20, 0x00, 0x10, 0x20, 0x73, 0x30,
+	0x20, 0x70, 0x00, 0x01, 0x73, 0x00, 0x00, 0x73, 0x70, 0x20, 0x10, 0x00, 0x00, 0x30, 0x00, 0x00,
+	0x00, 0x08, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00, 0x80, 0x08, 0x03, 0x70, 0x81, 0x00, 0x00, 0x00,
+	0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x70, 0x20, 0x01, 0x03, 0x70, 0x11, 0x00,
+	0x30, 0x00, 0x10, 0x30, 0x11, 0x70, 0x70, 0x10, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x70, 0x00, 0x70, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x10, 0x30, 0x00, 0x00, 0x00, 0x00, 0x77, 0x70, 0x00, 0x10,
+	0x01, 0x01, 0x02, 0x20, 0x11, 0x00, 0x20, 0x00, 0x10, 0x20, 0x13, 0x30, 0x20, 0x10, 0x00, 0x20,
+	0x00, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x32, 0x20, 0x00, 0x32, 0x07, 0x11, 0x10, 0x20, 0x10,
+	0x10, 0x20, 0x00, 0x12, 0x01, 0x10, 0x30, 0x01, 0x00, 0x40, 0x09, 0x07, 0x07, 0x01, 0x08, 0x08,
+	0x70, 0x81, 0x00, 0x02, 0x22, 0x00, 0x00, 0x09, 0x03, 0x70, 0x71, 0x00, 0x80, 0x00, 0x80, 0x10,
+	0x22, 0x20, 0x20, 0x20, 0x00, 0x03, 0x77, 0x00, 0x00, 0x78, 0x70, 0x70, 0x10, 0x00, 0x00, 0x20,
+	0x00, 0x00, 0x07, 0x07, 0x00, 0x11, 0x00, 0x70, 0x00, 0x70, 0x70, 0x22, 0x00, 0x00, 0x20, 0x00,
+	0x70, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x27, 0x20, 0x00, 0x20, 0x02, 0x77, 0x00, 0x00,
+	0x10, 0x70, 0x70, 0x00, 0x70, 0x07, 0x20, 0x00, 0x00, 0x00, 0x00, 0x03, 0x73, 0x00, 0x00, 0x73,
+	0x70, 0x20, 0x10, 0x00, 0x00, 0x20, 0x00, 0x00, 0x73, 0x30, 0x20, 0x70, 0x80, 0x20, 0x00, 0x12,
+	0x07, 0x20, 0x20, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00, 0x70, 0x04, 0x03, 0x70, 0x73,
+	0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x70, 0x20, 0x08, 0x08,
+	0x70, 0x14, 0x00, 0x70, 0x00, 0x70, 0x70, 0x14, 0x70, 0x70, 0x10, 0x00, 0x00, 0x00, 0x00, 0x70,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x30, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x70, 0x00, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x70,
+	0x70, 0x00, 0x30, 0x01, 0x01, 0x02, 0x20, 0x71, 0x00, 0x20, 0x00, 0x10, 0x20, 0x73, 0x30, 0x20,
+	0x70, 0x00, 0x20, 0x00, 0x70, 0x20, 0x00, 0x00, 0x00, 0x00, 0x72, 0x20, 0x00, 0x72, 0x00, 0x13,
+	0x30, 0x20, 0x10, 0x30, 0x20, 0x00, 0x32, 0x01, 0x10, 0x30, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x10, 0x30, 0x00, 0x00, 0x00, 0x00,
+	0x17, 0x30, 0x00, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x02, 0x20, 0x00,
+	0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x12, 0x20, 0x00, 0x12, 0x07, 0x00, 0x00, 0x00, 0x00, 0x02,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07, 0x12, 0x20, 0x00, 0x12, 0x01, 0x00, 0x02, 0x00,
+	0x01, 0x12, 0x01, 0x01, 0x02, 0x01, 0x04, 0x03, 0x70, 0x74, 0x00, 0x70, 0x00, 0x70, 0x70, 0x22,
+	0x20, 0x20, 0x20, 0x00, 0x30, 0x00, 0x70, 0x30, 0x00, 0x00, 0x00, 0x00, 0x27, 0x20, 0x00, 0x22,
+	0x00, 0x33, 0x70, 0x70, 0x30, 0x70, 0x70, 0x00, 0x77, 0x07, 0x20, 0x20, 0x02, 0x00, 0x00, 0x70,
+	0x00, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x72, 0x70, 0x00, 0x70, 0x07, 0x00, 0x00,
+	0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x02, 0x73, 0x30, 0x20, 0x70, 0x30, 0x20, 0x00, 0x32, 0x07,
+	0x20, 0x20, 0x02, 0x00, 0x70, 0x20, 0x00, 0x72, 0x00, 0x00, 0x02, 0x00, 0x07, 0x22, 0x00, 0x02,
+	0x02, 0x00, 0x20, 0x20, 0x02, 0x00, 0x20, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x02, 0x00, 0x10,
+	0x08, 0x07, 0x07, 0x01, 0x08, 0x03, 0x70, 0x11, 0x00, 0x03, 0x77, 0x00, 0x00, 0x08, 0x08, 0x70,
+	0x11, 0x00, 0x80, 0x00, 0x10, 0x10, 0x33, 0x70, 0x70, 0x30, 0x00, 0x08, 0x77, 0x00, 0x00, 0x71,
+	0x70, 0x20, 0x10, 0x00, 0x00, 0x70, 0x00, 0x00, 0x07, 0x07, 0x00, 0x11, 0x00, 0x70, 0x00, 0x10,
+	0x10, 0x77, 0x00, 0x00, 0x10, 0x00, 0x70, 0x00, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x77, 0x70,
+	0x00, 0x70, 0x07, 0x77, 0x00, 0x00, 0x10, 0x70, 0x20, 0x00, 0x10, 0x01, 0x70, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x73, 0x00, 0x00, 0x71, 0x70, 0x20, 0x10, 0x00, 0x00, 0x20, 0x00, 0x00, 0x13, 0x30,
+	0x20, 0x10, 0x10, 0x20, 0x00, 0x12, 0x01, 0x20, 0x20, 0x02, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00,
+	0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x03, 0x70, 0x11, 0x00, 0x30, 0x00,
+	0x10, 0x30, 0x88, 0x70, 0x70, 0x10, 0x00, 0x70, 0x00, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x77,
+	0x70, 0x00, 0x77, 0x07, 0x81, 0x70, 0x20, 0x10, 0x10, 0x20, 0x00, 0x12, 0x01, 0x10, 0x70, 0x07,
+	0x00, 0x00, 0x70, 0x00, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x77, 0x70, 0x00, 0x70, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x20, 0x00, 0x10,
+	0x01, 0x00, 0x02, 0x00, 0x01, 0x72, 0x07, 0x00, 0x00, 0x01, 0x13, 0x30, 0x20, 0x10, 0x10, 0x20,
+	0x00, 0x12, 0x01, 0x20, 0x20, 0x02, 0x00, 0x30, 0x20, 0x00, 0x32, 0x01, 0x00, 0x02, 0x00, 0x01,
+	0x22, 0x02, 0x02, 0x02, 0x02, 0x10, 0x30, 0x07, 0x00, 0x10, 0x07, 0x07, 0x02, 0x01, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x01, 0x77, 0x00, 0x00, 0x78, 0x70, 0x70, 0x10, 0x00, 0x00, 0x20, 0x00, 0x00,
+	0x11, 0x70, 0x70, 0x10, 0x80, 0x10, 0x00, 0x17, 0x01, 0x20, 0x20, 0x02, 0x00, 0x00, 0x00, 0x70,
+	0x00, 0x00, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x10, 0x70,
+	0x70, 0x00, 0x10, 0x01, 0x20, 0x00, 0x00, 0x00, 0x70, 0x70, 0x00, 0x10, 0x01, 0x00, 0x07, 0x00,
+	0x01, 0x21, 0x02, 0x00, 0x00, 0x02, 0x70, 0x00, 0x00, 0x00, 0x70, 0x07, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x10, 0x30, 0x07, 0x00, 0x10, 0x07, 0x07, 0x02, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x10, 0x07, 0x00,
+	0x40, 0x07, 0x07, 0x03, 0x03, 0x00, 0x00, 0x03, 0x00, 0x90, 0x07, 0x09, 0x03, 0x07, 0x08, 0x03,
+	0x30, 0x73, 0x00, 0x07, 0x73, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x01, 0x01, 0x08, 0x07, 0x07, 0x70, 0x77, 0x00, 0x03, 0x33,
+	0x00, 0x00, 0x07, 0x07, 0x70, 0x77, 0x00, 0x70, 0x00, 0x70, 0x70, 0x77, 0x70, 0x70, 0x70, 0x00,
+	0x01, 0x71, 0x00, 0x00, 0x77, 0x70, 0x70, 0x70, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x07,
+	0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x73, 0x00, 0x00, 0x73,
+	0x70, 0x20, 0x20, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x09, 0x09, 0x03, 0x03, 0x04, 0x03, 0x30, 0x33, 0x00, 0x01,
+	0x11, 0x00, 0x00, 0x07, 0x07, 0x70, 0x77, 0x00, 0x70, 0x00, 0x70, 0x70, 0x77, 0x70, 0x70, 0x70,
+	0x00, 0x01, 0x71, 0x00, 0x00, 0x74, 0x70, 0x30, 0x30, 0x00, 0x00, 0x10, 0x00, 0x00, 0x07, 0x07,
+	0x70, 0x77, 0x00, 0x70, 0x00, 0x70, 0x70, 0x77, 0x70, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 0x10, 0x10, 0x70, 0x70, 0x00,
+	0x77, 0x07, 0x10, 0x10, 0x01, 0x00, 0x00, 0x03, 0x73, 0x00, 0x00, 0x73, 0x70, 0x20, 0x20, 0x00,
+	0x00, 0x10, 0x00, 0x00, 0x73, 0x30, 0x20, 0x20, 0x30, 0x20, 0x00, 0x22, 0x02, 0x70, 0x30, 0x07,
+	0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x07, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x73, 0x00,
+	0x00, 0x78, 0x70, 0x30, 0x70, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x73, 0x00, 0x00, 0x77, 0x70, 0x70, 0x70,
+	0x00, 0x00, 0x20, 0x00, 0x00, 0x73, 0x30, 0x30, 0x70, 0x70, 0x70, 0x00, 0x77, 0x07, 0x20, 0x20,
+	0x02, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
+	0x00, 0x00, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x07, 0x08, 0x01, 0x07, 0x07, 0x07, 0x70,
+	0x77, 0x00, 0x07, 0x71, 0x00, 0x00, 0x07, 0x08, 0x80, 0x07, 0x00, 0x70, 0x00, 0x70, 0x70, 0x07,
+	0x70, 0x30, 0x00, 0x00, 0x08, 0x78, 0x00, 0x00, 0x77, 0x70, 0x70, 0x70, 0x00, 0x00, 0x10, 0x00,
+	0x00, 0x07, 0x07, 0x70, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x10, 0x10, 0x70, 0x00, 0x70,
+	0x00, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x00, 0x77, 0x00, 0x77, 0x70, 0x70, 0x70,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x01, 0x00, 0x00, 0x07, 0x78, 0x00, 0x00, 0x73, 0x70,
+	0x20, 0x20, 0x00, 0x00, 0x70, 0x00, 0x00, 0x07, 0x70, 0x20, 0x00, 0x70, 0x20, 0x00, 0x22, 0x00,
+	0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x08, 0x08, 0x80, 0x78, 0x00, 0x70, 0x00, 0x70, 0x70, 0x78, 0x80, 0x10, 0x70, 0x00,
+	0x70, 0x00, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x77, 0x70, 0x00, 0x77, 0x00, 0x81, 0x80, 0x10,
+	0x10, 0x70, 0x70, 0x00, 0x77, 0x07, 0x10, 0x10, 0x01, 0x00, 0x00, 0x70, 0x00, 0x70, 0x70, 0x00,
+	0x00, 0x00, 0x00, 0x70, 0x70, 0x00, 0x77, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x00, 0x77, 0x07, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01,
+	0x01, 0x01, 0x01, 0x73, 0x80, 0x20, 0x20, 0x30, 0x20, 0x00, 0x22, 0x02, 0x70, 0x10, 0x07, 0x00,
+	0x70, 0x20, 0x00, 0x22, 0x00, 0x00, 0x02, 0x00, 0x02, 0x72, 0x00, 0x07, 0x02, 0x00, 0x10, 0x10,
+	0x07, 0x00, 0x30, 0x07, 0x07, 0x02, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x78, 0x00, 0x00,
+	0x77, 0x70, 0x70, 0x70, 0x00, 0x00, 0x20, 0x00, 0x00, 0x07, 0x70, 0x30, 0x00, 0x70, 0x70, 0x00,
+	0x77, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x70, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x77, 0x70, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x02,
+	0x00, 0x70, 0x70, 0x00, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x02, 0x02, 0x00, 0x70,
+	0x70, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x70, 0x00,
+	0x00, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00,
+	0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x02, 0x22, 0x00, 0x00, 0x22, 0x20, 0x20, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22,
+	0x00, 0x00, 0x22, 0x20, 0x20, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x22, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x00, 0x22, 0x02, 0x20, 0x20, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x20, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+	0x22, 0x00, 0x00, 0x22, 0x20, 0x20, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x22, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x00, 0x22, 0x02, 0x20, 0x20, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x22, 0x02,
+	0x20, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x20, 0x20, 0x02, 0x00, 0x20, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x20, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x02,
+	0x00, 0x20, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20,
+	0x02, 0x00, 0x20, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00,
+};
+
+#endif  //EE33_RETRO_TABLE_DATA_H
@@ -0,0 +1,167 @@
+/**
+  * @file      EE33_Symmetry.cpp
+  * @version   v1.0
+  * @author    3lectron3ats <3lectron3ats@gmail.com>
+  * @date      2026.10.16
+  * @brief     Rotation and reflection of 3x3 matrix.
+  * @copyright GPL v3.0
+  * *************************************************************************************
+  * @attention
+  * <h2><center>&copy; COPYRIGHT 2023 3lectron3ats </center></h2>
+  * *************************************************************************************
+  */
+
+#include <EE33_Tic_Tac_Toe.h>
+#include <EE33_Symmetry.h>
+
+/** new position of each element */
+const uint8_t symmetry_element[MATRIX_SYMMETRY_TOTAL][MATRIX_3X3_ELEMENT_TOTAL] PROGMEM =
+{
+	{0, 1, 2, 3, 4, 5, 6, 7, 8},  //identity
+	{2, 5, 8, 1, 4, 7, 0, 3, 6},  //rotate 90
+	{8, 7, 6, 5, 4, 3, 2, 1, 0},  //rotate 180
+	{6, 3, 0, 7, 4, 1, 8, 5, 2},  //rotate 270
+	{2, 1, 0, 5, 4, 3, 8, 7, 6},  //mirror left-right
+	{6, 7, 8, 3, 4, 5, 0, 1, 2},  //mirror up-down
+	{0, 3, 6, 1, 4, 7, 2, 5, 8},  //transpose
+	{8, 5, 2, 7, 4, 1, 6, 3, 0},  //anti-transpose
+};
+
+/** transformed d16 of each row, indexed by the 3 bits of row */
+const uint16_t symmetry_row[MATRIX_SYMMETRY_TOTAL][MATRIX_3X3_LENGTH][1 << MATRIX_3X3_LENGTH] PROGMEM =
+{
+	{  //identity
+		{0x000, 0x001, 0x002, 0x003, 0x004, 0x005, 0x006, 0x007},
+		{0x000, 0x008, 0x010, 0x018, 0x020, 0x028, 0x030, 0x038},
+		{0x000, 0x040, 0x080, 0x0C0, 0x100, 0x140, 0x180, 0x1C0},
+	},
+	{  //rotate 90
+		{0x000, 0x004, 0x020, 0x024, 0x100, 0x104, 0x120, 0x124},
+		{0x000, 0x002, 0x010, 0x012, 0x080, 0x082, 0x090, 0x092},
+		{0x000, 0x001, 0x008, 0x009, 0x040, 0x041, 0x048, 0x049},
+	},
+	{  //rotate 180
+		{0x000, 0x100, 0x080, 0x180, 0x040, 0x140, 0x0C0, 0x1C0},
+		{0x000, 0x020, 0x010, 0x030, 0x008, 0x028, 0x018, 0x038},
+		{0x000, 0x004, 0x002, 0x006, 0x001, 0x005, 0x003, 0x007},
+	},
+	{  //rotate 270
+		{0x000, 0x040, 0x008, 0x048, 0x001, 0x041, 0x009, 0x049},
+		{0x000, 0x080, 0x010, 0x090, 0x002, 0x082, 0x012, 0x092},
+		{0x000, 0x100, 0x020, 0x120, 0x004, 0x104, 0x024, 0x124},
+	},
+	{  //mirror left-right
+		{0x000, 0x004, 0x002, 0x006, 0x001, 0x005, 0x003, 0x007},
+		{0x000, 0x020, 0x010, 0x030, 0x008, 0x028, 0x018, 0x038},
+		{0x000, 0x100, 0x080, 0x180, 0x040, 0x140, 0x0C0, 0x1C0},
+	},
+	{  //mirror up-down
+		{0x000, 0x040, 0x080, 0x0C0, 0x100, 0x140, 0x180, 0x1C0},
+		{0x000, 0x008, 0x010, 0x018, 0x020, 0x028, 0x030, 0x038},
+		{0x000, 0x001, 0x002, 0x003, 0x004, 0x005, 0x006, 0x007},
+	},
+	{  //transpose
+		{0x000, 0x001, 0x008, 0x009, 0x040, 0x041, 0x048, 0x049},
+		{0x000, 0x002, 0x010, 0x012, 0x080, 0x082, 0x090, 0x092},
+		{0x000, 0x004, 0x020, 0x024, 0x100, 0x104, 0x120, 0x124},
+	},
+	{  //anti-transpose
+		{0x000, 0x100, 0x020, 0x120, 0x004, 0x104, 0x024, 0x124},
+		{0x000, 0x080, 0x010, 0x090, 0x002, 0x082, 0x012, 0x092},
+		{0x000, 0x040, 0x008, 0x048, 0x001, 0x041, 0x009, 0x049},
+	},
+};
+
+/** symmetry which undo each symmetry */
+const uint8_t symmetry_inverse[MATRIX_SYMMETRY_TOTAL] PROGMEM =
+{
+	MATRIX_SYMMETRY_IDENTITY,
+	MATRIX_SYMMETRY_ROTATE_270,
+	MATRIX_SYMMETRY_ROTATE_180,
+	MATRIX_SYMMETRY_ROTATE_90,
+	MATRIX_SYMMETRY_MIRROR_LR,
+	MATRIX_SYMMETRY_MIRROR_UD,
+	MATRIX_SYMMETRY_TRANSPOSE,
+	MATRIX_SYMMETRY_ANTI_TRANSPOSE,
+};
+
+T_MATRIX_3X3 MatrixSymmetry::transform(T_MATRIX_3X3 MatrixMap, MATRIX_SYMMETRY symmetry)
+{
+	T_MATRIX_3X3 result;
+
+	result.d16 = pgm_read_word(&symmetry_row[symmetry][0][MatrixMap.d16 & 0x07]) |
+	             pgm_read_word(&symmetry_row[symmetry][1][(MatrixMap.d16 >> 3) & 0x07]) |
+	             pgm_read_word(&symmetry_row[symmetry][2][(MatrixMap.d16 >> 6) & 0x07]);
+
+	return result;
+}
+
+MATRIX_3X3_ELEMENT MatrixSymmetry::transform_element(MATRIX_3X3_ELEMENT element, MATRIX_SYMMETRY symmetry)
+{
+	return (MATRIX_3X3_ELEMENT)pgm_read_byte(&symmetry_element[symmetry][element]);
+}
+
+MATRIX_SYMMETRY MatrixSymmetry::inverse(MATRIX_SYMMETRY symmetry)
+{
+	return (MATRIX_SYMMETRY)pgm_read_byte(&symmetry_inverse[symmetry]);
+}
+
+MATRIX_SYMMETRY MatrixSymmetry::canonical(T_MATRIX_3X3 *MatrixMap_Friend, T_MATRIX_3X3 *MatrixMap_Enmy)
+{
+	MATRIX_SYMMETRY symmetry, result = MATRIX_SYMMETRY_IDENTITY;
+	T_MATRIX_3X3 friend_min = *MatrixMap_Friend;
+	T_MATRIX_3X3 enmy_min = *MatrixMap_Enmy;
+
+	for (symmetry = MATRIX_SYMMETRY_ROTATE_90; symmetry < MATRIX_SYMMETRY_TOTAL; symmetry = (MATRIX_SYMMETRY)(symmetry + 1))
+	{
+		T_MATRIX_3X3 map_friend = transform(*MatrixMap_Friend, symmetry);
+
+		if (map_friend.d16 > friend_min.d16)
+		{
+			continue;
+		}
+
+		T_MATRIX_3X3 map_enmy = transform(*MatrixMap_Enmy, symmetry);
+
+		if (map_friend.d16 < friend_min.d16 || map_enmy.d16 < enmy_min.d16)
+		{
+			friend_min = map_friend;
+			enmy_min = map_enmy;
+			result = symmetry;
+		}
+	}
+
+	*MatrixMap_Friend = friend_min;
+	*MatrixMap_Enmy = enmy_min;
+
+	return result;
+}
+
+T_MATRIX_3X3 MatrixSymmetry::restore(T_MATRIX_3X3 MatrixMap, MATRIX_SYMMETRY symmetry)
+{
+	return transform(MatrixMap, inverse(symmetry));
+}
+
+uint8_t MatrixSymmetry::stabilizer(T_MATRIX_3X3 MatrixMap_Friend, T_MATRIX_3X3 MatrixMap_Enmy)
+{
+	MATRIX_SYMMETRY symmetry;
+	uint8_t result = bit(MATRIX_SYMMETRY_IDENTITY);
+
+	for (symmetry = MATRIX_SYMMETRY_ROTATE_90; symmetry < MATRIX_SYMMETRY_TOTAL; symmetry = (MATRIX_SYMMETRY)(symmetry + 1))
+	{
+		if (transform(MatrixMap_Friend, symmetry).d16 == MatrixMap_Friend.d16 &&
+		    transform(MatrixMap_Enmy, symmetry).d16 == MatrixMap_Enmy.d16)
+		{
+			result |= bit(symmetry);
+		}
+	}
+
+	return result;
+}
+
+
+/*
+ * @release note
+ * | v1.0 2026-10-16 - 3lectron3ats : Initial Release
+ * #
+*/
@@ -0,0 +1,108 @@
+/**
+  * @file      EE33_Symmetry.h
+  * @version   v1.0
+  * @author    3lectron3ats <3lectron3ats@gmail.com>
+  * @date      2026.10.16
+  * @brief     Rotation and reflection of 3x3 matrix.
+  * @copyright GPL v3.0
+  * *************************************************************************************
+  * @attention
+  * <h2><center>&copy; COPYRIGHT 2023 3lectron3ats </center></h2>
+  * *************************************************************************************
+  * @note
+  *   A position and its 7 rotations/reflections have the same minmax score, so search
+  *   cache and table only need to keep the canonical one. Canonical position is the
+  *   one with the smallest (friend << 9 | enmy).
+  */
+
+
+#ifndef EE33_SYMMETRY_H
+#define EE33_SYMMETRY_H
+
+// Arduino versioning.
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "Arduino.h"	// for digitalRead, digitalWrite, etc
+#else
+#include "WProgram.h"
+#endif
+
+#include <EE33_Matrix.h>
+
+#define SYMMETRY_VERSION_MAJOR  1
+#define SYMMETRY_VERSION_MINOR  0
+
+/*! rotation and reflection of 3x3 matrix */
+typedef enum
+{
+	MATRIX_SYMMETRY_IDENTITY = 0,     /*!< no change */
+	MATRIX_SYMMETRY_ROTATE_90,        /*!< rotate 90 degree clockwise */
+	MATRIX_SYMMETRY_ROTATE_180,       /*!< rotate 180 degree */
+	MATRIX_SYMMETRY_ROTATE_270,       /*!< rotate 270 degree clockwise */
+	MATRIX_SYMMETRY_MIRROR_LR,        /*!< mirror left and right */
+	MATRIX_SYMMETRY_MIRROR_UD,        /*!< mirror up and down */
+	MATRIX_SYMMETRY_TRANSPOSE,        /*!< mirror by M11-M33 diagonal */
+	MATRIX_SYMMETRY_ANTI_TRANSPOSE,   /*!< mirror by M13-M31 diagonal */
+
+	MATRIX_SYMMETRY_TOTAL,
+} MATRIX_SYMMETRY;
+
+class MatrixSymmetry
+{
+public:
+
+/**
+	* @brief  rotate or reflect a matrix
+	* @param  MatrixMap
+	* @param  symmetry
+	* @return transformed matrix
+	*/
+	static T_MATRIX_3X3 transform(T_MATRIX_3X3 MatrixMap, MATRIX_SYMMETRY symmetry);
+
+/**
+	* @brief  position of an element after rotate or reflect
+	* @param  element
+	* @param  symmetry
+	* @return transformed element
+	*/
+	static MATRIX_3X3_ELEMENT transform_element(MATRIX_3X3_ELEMENT element, MATRIX_SYMMETRY symmetry);
+
+/**
+	* @brief  the symmetry which undo the specify symmetry
+	* @param  symmetry
+	* @return inverse symmetry
+	*/
+	static MATRIX_SYMMETRY inverse(MATRIX_SYMMETRY symmetry);
+
+/**
+	* @brief  transform friend and enmy map to the canonical position
+	* @param  *MatrixMap_Friend map of friend, be replaced by canonical one
+	* @param  *MatrixMap_Enmy map of enmy, be replaced by canonical one
+	* @return symmetry applied, restore() with it gets the original position back
+	*/
+	static MATRIX_SYMMETRY canonical(T_MATRIX_3X3 *MatrixMap_Friend, T_MATRIX_3X3 *MatrixMap_Enmy);
+
+/**
+	* @brief  transform canonical matrix back to the original position
+	* @param  MatrixMap matrix in canonical position, for example the best moves
+	* @param  symmetry return value of canonical()
+	* @return matrix in original position
+	*/
+	static T_MATRIX_3X3 restore(T_MATRIX_3X3 MatrixMap, MATRIX_SYMMETRY symmetry);
+
+/**
+	* @brief  find all the symmetries which keep the position unchanged
+	* @param  MatrixMap_Friend map of friend
+	* @param  MatrixMap_Enmy map of enmy
+	* @return bit n set means MATRIX_SYMMETRY n keeps the position unchanged
+	*/
+	static uint8_t stabilizer(T_MATRIX_3X3 MatrixMap_Friend, T_MATRIX_3X3 MatrixMap_Enmy);
+};
+
+#endif  //EE33_SYMMETRY_H
+
+
+/*
+ * @release note
+ * | v1.0 2026-10-16 - 3lectron3ats : Initial Release
+ * #
+*/
@@ -21,8 +21,10 @@
 
 #if defined(__AVR_ATmega328P__)
 
+#elif defined(EE33_HOST_BUILD)
+  // engine build on Linux host against extras/host/Arduino.h
 #else
-  #error “This library only supports boards with an ATmega328P processor.”
+  #error "This library only supports boards with an ATmega328P processor."
 #endif
 
 #define Tic_Tac_Toe_println(...)   \
@@ -0,0 +1,466 @@
+/**
+  * @file      EE33_Ultimate.cpp
+  * @version   v1.0
+  * @author    3lectron3ats <3lectron3ats@gmail.com>
+  * @date      2026.10.16
+  * @brief     Ultimate Tic-Tac-Toe on 9x9 matrix, board model and search engine.
+  * @copyright GPL v3.0
+  * *************************************************************************************
+  * @attention
+  * <h2><center>&copy; COPYRIGHT 2023 3lectron3ats </center></h2>
+  * *************************************************************************************
+  */
+
+#include <EE33_Tic_Tac_Toe.h>
+#include <EE33_Ultimate.h>
+
+#define ULTIMATE_OTHER(player)  ((player == PLAYER_TYPE_FRIEND) ? PLAYER_TYPE_ENMY : PLAYER_TYPE_FRIEND)
+
+UltimateBoard::UltimateBoard()
+{
+	clear();
+
+	search_horizon = ULTIMATE_SEARCH_DEPTH;
+	search_abort = false;
+	search_budget_us = 0;
+	search_start_us = 0;
+	reset_SearchNode();
+}
+
+void UltimateBoard::clear(void)
+{
+	memset(sub_map, 0, sizeof(sub_map));
+	memset(meta_map, 0, sizeof(meta_map));
+	memset(board_score, 0, sizeof(board_score));
+
+	closed = 0;
+	next_board = ULTIMATE_BOARD_ANY;
+	meta_score = 0;
+	score_sum = 0;
+}
+
+uint8_t UltimateBoard::cell(uint8_t board, uint8_t element)
+{
+	uint8_t row = (board / MATRIX_3X3_LENGTH) * MATRIX_3X3_LENGTH + element / MATRIX_3X3_LENGTH;
+	uint8_t column = (board % MATRIX_3X3_LENGTH) * MATRIX_3X3_LENGTH + element % MATRIX_3X3_LENGTH;
+
+	return row * ULTIMATE_LENGTH + column;
+}
+
+uint8_t UltimateBoard::board_of(uint8_t cell)
+{
+	uint8_t row = cell / ULTIMATE_LENGTH, column = cell % ULTIMATE_LENGTH;
+
+	return (row / MATRIX_3X3_LENGTH) * MATRIX_3X3_LENGTH + column / MATRIX_3X3_LENGTH;
+}
+
+uint8_t UltimateBoard::element_of(uint8_t cell)
+{
+	uint8_t row = cell / ULTIMATE_LENGTH, column = cell % ULTIMATE_LENGTH;
+
+	return (row % MATRIX_3X3_LENGTH) * MATRIX_3X3_LENGTH + column % MATRIX_3X3_LENGTH;
+}
+
+bool UltimateBoard::set_Cell(uint8_t cell, PLAYER_TYPE player)
+{
+	if (!Is_Legal(cell))
+	{
+		return false;
+	}
+
+	_make(board_of(cell) * ULTIMATE_BOARD_TOTAL + element_of(cell), player);
+
+	return true;
+}
+
+bool UltimateBoard::Is_Legal(uint8_t cell)
+{
+	uint8_t board, element;
+
+	if (cell >= ULTIMATE_CELL_TOTAL || Is_Over())
+	{
+		return false;
+	}
+
+	board = board_of(cell);
+	element = element_of(cell);
+
+	return _is_open(board) && (next_board == ULTIMATE_BOARD_ANY || next_board == board)
+		&& !((sub_map[board][PLAYER_TYPE_FRIEND].d16 | sub_map[board][PLAYER_TYPE_ENMY].d16) & MatrixBit::mask((MATRIX_3X3_ELEMENT)element));
+}
+
+uint8_t UltimateBoard::get_NextBoard(void)
+{
+	return next_board;
+}
+
+T_MATRIX_3X3 UltimateBoard::get_SubMap(uint8_t board, PLAYER_TYPE player)
+{
+	return sub_map[board][player];
+}
+
+T_MATRIX_3X3 UltimateBoard::get_MetaMap(PLAYER_TYPE player)
+{
+	return meta_map[player];
+}
+
+bool UltimateBoard::Is_Bingo(PLAYER_TYPE player)
+{
+	return MatrixLine::Is_Bingo(meta_map[player]);
+}
+
+bool UltimateBoard::Is_Over(void)
+{
+	return closed == MATRIX_3X3_MASK || Is_Bingo(PLAYER_TYPE_FRIEND) || Is_Bingo(PLAYER_TYPE_ENMY);
+}
+
+uint8_t UltimateBoard::find_IdleLed_Forward(uint8_t LED_now)
+{
+	uint8_t position = (LED_now < ULTIMATE_CELL_TOTAL - 1) ? LED_now + 1 : 0;
+
+	for (uint8_t i = 0; i < ULTIMATE_CELL_TOTAL; i++)
+	{
+		if (Is_Legal(position))
+		{
+			return position;
+		}
+
+		position = (position < ULTIMATE_CELL_TOTAL - 1) ? position + 1 : 0;
+	}
+
+	return ULTIMATE_CELL_NONE;
+}
+
+uint8_t UltimateBoard::find_IdleLed_Backword(uint8_t LED_now)
+{
+	uint8_t position = (LED_now > 0 && LED_now < ULTIMATE_CELL_TOTAL) ? LED_now - 1 : ULTIMATE_CELL_TOTAL - 1;
+
+	for (uint8_t i = 0; i < ULTIMATE_CELL_TOTAL; i++)
+	{
+		if (Is_Legal(position))
+		{
+			return position;
+		}
+
+		position = (position > 0) ? position - 1 : ULTIMATE_CELL_TOTAL - 1;
+	}
+
+	return ULTIMATE_CELL_NONE;
+}
+
+int16_t UltimateBoard::get_Score(void)
+{
+	return score_sum;
+}
+
+uint8_t UltimateBoard::BestNextMove(PLAYER_TYPE player, uint32_t budget_us)
+{
+	PLAYER_TYPE other = ULTIMATE_OTHER(player);
+	uint8_t BestMove = ULTIMATE_CELL_NONE;
+
+	if (Is_Over())
+	{
+		return ULTIMATE_CELL_NONE;
+	}
+
+	search_abort = false;
+	search_budget_us = 0;  //first round is never stopped, there must be a move
+	search_start_us = micros();
+
+	for (search_horizon = (budget_us) ? 1 : ULTIMATE_SEARCH_DEPTH; search_horizon <= ULTIMATE_SEARCH_DEPTH; search_horizon++)
+	{
+		uint8_t first = (next_board == ULTIMATE_BOARD_ANY) ? 0 : next_board * ULTIMATE_BOARD_TOTAL;
+		uint8_t last = (next_board == ULTIMATE_BOARD_ANY) ? ULTIMATE_CELL_TOTAL : first + ULTIMATE_BOARD_TOTAL;
+		uint8_t board_before = next_board, RoundMove = ULTIMATE_CELL_NONE, ties = 0;
+		int16_t ScoreMax = -ULTIMATE_SCORE_INFINITE, score;
+
+		for (uint8_t move = first; move < last && !search_abort; move++)
+		{
+			uint8_t board = move / ULTIMATE_BOARD_TOTAL, element = move % ULTIMATE_BOARD_TOTAL;
+
+			if (!_is_open(board) || ((sub_map[board][PLAYER_TYPE_FRIEND].d16 | sub_map[board][PLAYER_TYPE_ENMY].d16) & MatrixBit::mask((MATRIX_3X3_ELEMENT)element)))
+			{
+				continue;
+			}
+
+			_make(move, player);
+
+			//window above ScoreMax - 1, so a score inside is exact and a tie is a tie
+			score = -_search(other, -ULTIMATE_SCORE_INFINITE, (ScoreMax == -ULTIMATE_SCORE_INFINITE) ? ULTIMATE_SCORE_INFINITE : -(ScoreMax - 1));
+
+			_unmake(move, player, board_before);
+
+			if (search_abort)
+			{
+				break;
+			}
+
+			if (score > ScoreMax)
+			{
+				ScoreMax = score;
+				RoundMove = move;
+				ties = 1;
+			}
+			else if (score == ScoreMax && random(++ties) == 0)
+			{
+				RoundMove = move;
+			}
+		}
+
+		if (search_abort)
+		{
+			break;
+		}
+
+		BestMove = RoundMove;
+		search_budget_us = budget_us;
+
+		if (ScoreMax >= ULTIMATE_SCORE_WIN - ULTIMATE_SEARCH_DEPTH || ScoreMax <= -(ULTIMATE_SCORE_WIN - ULTIMATE_SEARCH_DEPTH))
+		{
+			break;  //game is decided, deeper search does not change it
+		}
+	}
+
+	return cell(BestMove / ULTIMATE_BOARD_TOTAL, BestMove % ULTIMATE_BOARD_TOTAL);
+}
+
+uint32_t UltimateBoard::get_SearchNode(void)
+{
+	return search_node;
+}
+
+void UltimateBoard::reset_SearchNode(void)
+{
+	search_node = 0;
+}
+
+uint16_t UltimateBoard::get_SearchStackSize(void)
+{
+	return sizeof(T_ULTIMATE_FRAME) * ULTIMATE_SEARCH_DEPTH;
+}
+
+
+bool UltimateBoard::_is_open(uint8_t board)
+{
+	return !(closed & MatrixBit::mask((MATRIX_3X3_ELEMENT)board));
+}
+
+void UltimateBoard::_make(uint8_t move, PLAYER_TYPE player)
+{
+	uint8_t board = move / ULTIMATE_BOARD_TOTAL, element = move % ULTIMATE_BOARD_TOTAL;
+
+	sub_map[board][player].d16 |= MatrixBit::mask((MATRIX_3X3_ELEMENT)element);
+
+	if (MatrixLine::Is_Bingo(sub_map[board][player]))
+	{
+		meta_map[player].d16 |= MatrixBit::mask((MATRIX_3X3_ELEMENT)board);
+		closed |= MatrixBit::mask((MATRIX_3X3_ELEMENT)board);
+		_update_meta();
+	}
+	else if ((sub_map[board][PLAYER_TYPE_FRIEND].d16 | sub_map[board][PLAYER_TYPE_ENMY].d16) == MATRIX_3X3_MASK)
+	{
+		closed |= MatrixBit::mask((MATRIX_3X3_ELEMENT)board);
+		_update_meta();
+	}
+
+	_update_board(board);
+
+	next_board = _is_open(element) ? (uint8_t)element : (uint8_t)ULTIMATE_BOARD_ANY;
+}
+
+void UltimateBoard::_unmake(uint8_t move, PLAYER_TYPE player, uint8_t board_before)
+{
+	uint8_t board = move / ULTIMATE_BOARD_TOTAL, element = move % ULTIMATE_BOARD_TOTAL;
+
+	sub_map[board][player].d16 &= ~MatrixBit::mask((MATRIX_3X3_ELEMENT)element);
+
+	//board was open before the move
+	if (!_is_open(board))
+	{
+		meta_map[player].d16 &= ~MatrixBit::mask((MATRIX_3X3_ELEMENT)board);
+		closed &= ~MatrixBit::mask((MATRIX_3X3_ELEMENT)board);
+		_update_meta();
+	}
+
+	_update_board(board);
+
+	next_board = board_before;
+}
+
+void UltimateBoard::_update_board(uint8_t board)
+{
+	T_MATRIX_3X3 own = sub_map[board][PLAYER_TYPE_FRIEND], other = sub_map[board][PLAYER_TYPE_ENMY];
+	int8_t score = 0;
+
+	if (meta_map[PLAYER_TYPE_FRIEND].d16 & MatrixBit::mask((MATRIX_3X3_ELEMENT)board))
+	{
+		score = ULTIMATE_SCORE_BOARD;
+	}
+	else if (meta_map[PLAYER_TYPE_ENMY].d16 & MatrixBit::mask((MATRIX_3X3_ELEMENT)board))
+	{
+		score = -ULTIMATE_SCORE_BOARD;
+	}
+	else if (_is_open(board))
+	{
+		//pieces on lines without other pieces, two in a line count 4
+		for (uint8_t line = LINE_1; line < LINE_SEQ_TOTAL; line++)
+		{
+			uint16_t mask = MatrixLine::get_LineMask((LINE_SEQUENCE)line);
+			uint8_t own_count = MatrixBit::count(own.d16 & mask), other_count = MatrixBit::count(other.d16 & mask);
+
+			if (!other_count)
+			{
+				score += own_count * own_count;
+			}
+			else if (!own_count)
+			{
+				score -= other_count * other_count;
+			}
+		}
+	}
+
+	score_sum += score - board_score[board];
+	board_score[board] = score;
+}
+
+void UltimateBoard::_update_meta(void)
+{
+	uint16_t own = meta_map[PLAYER_TYPE_FRIEND].d16, other = meta_map[PLAYER_TYPE_ENMY].d16;
+	uint16_t drawn = closed & ~(own | other);
+	int16_t score = 0;
+
+	//a drawn sub-board blocks the line for both
+	for (uint8_t line = LINE_1; line < LINE_SEQ_TOTAL; line++)
+	{
+		uint16_t mask = MatrixLine::get_LineMask((LINE_SEQUENCE)line);
+		uint8_t own_count = MatrixBit::count(own & mask), other_count = MatrixBit::count(other & mask);
+
+		if (drawn & mask)
+		{
+			continue;
+		}
+
+		if (!other_count)
+		{
+			score += own_count * own_count * ULTIMATE_SCORE_BOARD;
+		}
+		else if (!own_count)
+		{
+			score -= other_count * other_count * ULTIMATE_SCORE_BOARD;
+		}
+	}
+
+	score_sum += score - meta_score;
+	meta_score = score;
+}
+
+void UltimateBoard::_search_enter(T_ULTIMATE_FRAME *frame, PLAYER_TYPE player, int16_t alpha, int16_t beta, uint8_t ply)
+{
+	search_node++;
+
+	if (search_budget_us && !(search_node & (ULTIMATE_TIME_CHECK_NODES - 1)) && micros() - search_start_us >= search_budget_us)
+	{
+		search_abort = true;
+	}
+
+	frame->next_board = next_board;
+	frame->scan = 0;
+	frame->scan_end = 0;
+
+	if (Is_Bingo(ULTIMATE_OTHER(player)))
+	{
+		//the other one just won, quicker win is worse for us
+		frame->best = -(ULTIMATE_SCORE_WIN - ply);
+	}
+	else if (closed == MATRIX_3X3_MASK)
+	{
+		frame->best = 0;
+	}
+	else if (ply >= search_horizon)
+	{
+		frame->best = (player == PLAYER_TYPE_FRIEND) ? score_sum : -score_sum;
+	}
+	else
+	{
+		frame->scan = (next_board == ULTIMATE_BOARD_ANY) ? 0 : next_board * ULTIMATE_BOARD_TOTAL;
+		frame->scan_end = (next_board == ULTIMATE_BOARD_ANY) ? ULTIMATE_CELL_TOTAL : frame->scan + ULTIMATE_BOARD_TOTAL;
+		frame->alpha = alpha;
+		frame->beta = beta;
+		frame->best = -ULTIMATE_SCORE_INFINITE;
+	}
+}
+
+int16_t UltimateBoard::_search(PLAYER_TYPE player, int16_t alpha, int16_t beta)
+{
+	T_ULTIMATE_FRAME *frame = &search_stack[0];
+	PLAYER_TYPE turn = player;
+	int16_t score;
+
+	_search_enter(frame, turn, alpha, beta, 1);
+
+	while (!search_abort)
+	{
+		if (frame->scan < frame->scan_end)
+		{
+			uint8_t move = frame->scan++;
+			uint8_t board = move / ULTIMATE_BOARD_TOTAL, element = move % ULTIMATE_BOARD_TOTAL;
+
+			if (!_is_open(board))
+			{
+				frame->scan = (board + 1) * ULTIMATE_BOARD_TOTAL;  //skip the whole sub-board
+				continue;
+			}
+
+			if ((sub_map[board][PLAYER_TYPE_FRIEND].d16 | sub_map[board][PLAYER_TYPE_ENMY].d16) & MatrixBit::mask((MATRIX_3X3_ELEMENT)element))
+			{
+				continue;
+			}
+
+			frame->move = move;
+			_make(move, turn);
+			turn = ULTIMATE_OTHER(turn);
+
+			_search_enter(frame + 1, turn, -frame->beta, -frame->alpha, frame - &search_stack[0] + 2);
+
+			frame++;
+			continue;
+		}
+
+		score = frame->best;
+
+		if (frame == &search_stack[0])
+		{
+			return score;
+		}
+
+		frame--;
+		turn = ULTIMATE_OTHER(turn);
+		_unmake(frame->move, turn, frame->next_board);
+		score = -score;
+
+		frame->best = (score > frame->best) ? score : frame->best;
+		frame->alpha = (score > frame->alpha) ? score : frame->alpha;
+
+		if (frame->beta <= frame->alpha)
+		{
+			frame->scan = frame->scan_end;
+		}
+	}
+
+	//out of time, take the moves on stack back, caller drops the score
+	while (frame != &search_stack[0])
+	{
+		frame--;
+		turn = ULTIMATE_OTHER(turn);
+		_unmake(frame->move, turn, frame->next_board);
+	}
+
+	return 0;
+}
+
+
+/*
+ * @release note
+ * | v1.0 2026-10-16 - 3lectron3ats : Initial Release
+ * #
+*/
@@ -0,0 +1,281 @@
+/**
+  * @file      EE33_Ultimate.h
+  * @version   v1.0
+  * @author    3lectron3ats <3lectron3ats@gmail.com>
+  * @date      2026.10.16
+  * @brief     Ultimate Tic-Tac-Toe on 9x9 matrix, board model and search engine.
+  * @copyright GPL v3.0
+  * *************************************************************************************
+  * @attention
+  * <h2><center>&copy; COPYRIGHT 2023 3lectron3ats </center></h2>
+  * *************************************************************************************
+  * @note
+  *   9x9 matrix is 9 sub-boards of 3x3, each one kept as T_MATRIX_3X3 per player, and
+  *   sub-boards won make the meta-board, also T_MATRIX_3X3. A move on element n of a
+  *   sub-board sends the other one to sub-board n; if that one is won or full, any
+  *   open sub-board may be taken. Three sub-boards in a line on meta-board win.
+  *   Cells of the public API are in LED order of the 9x9 matrix, row * 9 + column, so
+  *   the encoder UI walks them the same way as LED_SQUARE::find_IdleLed_Forward.
+  *   Search is alpha-beta on an iterative stack of ULTIMATE_SEARCH_DEPTH frames; moves
+  *   are made and taken back on the board, and only the score of the sub-board touched
+  *   is evaluated again, so the whole engine takes about 150 bytes of SRAM.
+  * @par    sample code
+  * @code
+  *       UltimateBoard board;
+  *
+  *       board.set_Cell(40, PLAYER_TYPE_ENMY);  //center of center sub-board
+  *       next_step = board.BestNextMove(PLAYER_TYPE_FRIEND, 500000);
+  *       cursor = board.find_IdleLed_Forward(cursor);
+  * @endcode
+  */
+
+
+#ifndef EE33_ULTIMATE_H
+#define EE33_ULTIMATE_H
+
+// Arduino versioning.
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "Arduino.h"	// for digitalRead, digitalWrite, etc
+#else
+#include "WProgram.h"
+#endif
+
+#include <EE33_Matrix.h>
+
+#define ULTIMATE_VERSION_MAJOR  1
+#define ULTIMATE_VERSION_MINOR  0
+
+/** sub-boards on meta-board, also cells of a sub-board */
+#define ULTIMATE_BOARD_TOTAL        MATRIX_3X3_ELEMENT_TOTAL
+
+/** rows or columns of 9x9 matrix */
+#define ULTIMATE_LENGTH             (MATRIX_3X3_LENGTH * MATRIX_3X3_LENGTH)
+
+/** cells of 9x9 matrix */
+#define ULTIMATE_CELL_TOTAL         (ULTIMATE_LENGTH * ULTIMATE_LENGTH)
+
+/** no cell, board full or no legal move */
+#define ULTIMATE_CELL_NONE          ULTIMATE_CELL_TOTAL
+
+/** next move may be on any open sub-board */
+#define ULTIMATE_BOARD_ANY          ULTIMATE_BOARD_TOTAL
+
+/** score of winning the game, bigger than any guess */
+#define ULTIMATE_SCORE_WIN          10000
+
+/** bigger than any score, bound of the full alpha-beta window */
+#define ULTIMATE_SCORE_INFINITE     (ULTIMATE_SCORE_WIN + 1)
+
+/** score of a sub-board won */
+#define ULTIMATE_SCORE_BOARD        24
+
+/** plies searched without time budget, also frames of search stack */
+#define ULTIMATE_SEARCH_DEPTH       6
+
+/** nodes between two checks of the time budget, must be power of 2 */
+#define ULTIMATE_TIME_CHECK_NODES   64
+
+/*! one position of the search, the board itself is kept on UltimateBoard */
+typedef struct
+{
+	uint8_t  scan;             /*!< next board * 9 + element to try */
+	uint8_t  scan_end;         /*!< end of scan */
+	uint8_t  move;             /*!< board * 9 + element being searched */
+	uint8_t  next_board;       /*!< sent-to sub-board before move */
+	int16_t  alpha;
+	int16_t  beta;
+	int16_t  best;             /*!< best score of searched moves */
+} T_ULTIMATE_FRAME;
+
+
+class UltimateBoard
+{
+public:
+
+/**
+	* @brief  construction, empty board, any sub-board may be taken
+	*/
+	UltimateBoard();
+
+/**
+	* @brief  take all pieces away
+	*/
+	void clear(void);
+
+/**
+	* @brief  cell of 9x9 matrix
+	* @param  board sub-board, MATRIX_3X3_ELEMENT order on meta-board
+	* @param  element element of sub-board
+	* @return row * 9 + column
+	*/
+	static uint8_t cell(uint8_t board, uint8_t element);
+
+/**
+	* @brief  sub-board of cell
+	* @param  cell row * 9 + column
+	*/
+	static uint8_t board_of(uint8_t cell);
+
+/**
+	* @brief  element of cell in its sub-board
+	* @param  cell row * 9 + column
+	*/
+	static uint8_t element_of(uint8_t cell);
+
+/**
+	* @brief  put a piece, sent-to sub-board follows the element
+	* @param  cell row * 9 + column
+	* @param  player
+	* @retval true done
+	* @retval false cell is not a legal move
+	*/
+	bool set_Cell(uint8_t cell, PLAYER_TYPE player);
+
+/**
+	* @brief  cell can be taken by the next move or not
+	* @param  cell row * 9 + column
+	*/
+	bool Is_Legal(uint8_t cell);
+
+/**
+	* @brief  get sub-board the next move must be on
+	* @return sub-board, ULTIMATE_BOARD_ANY means any open one
+	*/
+	uint8_t get_NextBoard(void);
+
+/**
+	* @brief  get pieces of player on a sub-board
+	* @param  board
+	* @param  player
+	*/
+	T_MATRIX_3X3 get_SubMap(uint8_t board, PLAYER_TYPE player);
+
+/**
+	* @brief  get sub-boards won by player
+	* @param  player
+	*/
+	T_MATRIX_3X3 get_MetaMap(PLAYER_TYPE player);
+
+/**
+	* @brief  player has three sub-boards in a line or not
+	* @param  player
+	*/
+	bool Is_Bingo(PLAYER_TYPE player);
+
+/**
+	* @brief  game is over or not
+	* @retval true somebody won, or no legal move is left
+	*/
+	bool Is_Over(void);
+
+/**
+	* @brief  find the next legal cell after LED_now in LED order, for the encoder UI
+	* @param  LED_now row * 9 + column, ULTIMATE_CELL_NONE starts from the first cell
+	* @return cell, ULTIMATE_CELL_NONE if no legal move
+	*/
+	uint8_t find_IdleLed_Forward(uint8_t LED_now);
+
+/**
+	* @brief  find the legal cell before LED_now in LED order, for the encoder UI
+	* @param  LED_now row * 9 + column, ULTIMATE_CELL_NONE starts from the last cell
+	* @return cell, ULTIMATE_CELL_NONE if no legal move
+	*/
+	uint8_t find_IdleLed_Backword(uint8_t LED_now);
+
+/**
+	* @brief  guess of the position
+	* @return score in view of friend, the same one search uses at its horizon
+	*/
+	int16_t get_Score(void);
+
+/**
+	* @brief  calculate the next step of player
+	* @param  player the one to move
+	* @param  budget_us time limit in microseconds, 0 means search ULTIMATE_SEARCH_DEPTH plies
+	* @return cell, ULTIMATE_CELL_NONE if no legal move
+	* @note   with budget, search goes one ply deeper each round and the best move of
+	*         the last finished round is taken. Moves of the same score are picked
+	*         randomly.
+	*/
+	uint8_t BestNextMove(PLAYER_TYPE player, uint32_t budget_us = 0);
+
+/**
+	* @brief  get positions visited by search
+	* @return node counter, it keeps adding up until reset_SearchNode
+	*/
+	uint32_t get_SearchNode(void);
+
+/**
+	* @brief  clear node counter
+	*/
+	void reset_SearchNode(void);
+
+/**
+	* @brief  get SRAM bytes of search stack
+	*/
+	static uint16_t get_SearchStackSize(void);
+
+private:
+
+	bool _is_open(uint8_t board);
+
+	void _make(uint8_t move, PLAYER_TYPE player);
+
+	void _unmake(uint8_t move, PLAYER_TYPE player, uint8_t next_board);
+
+/**
+	* @brief  evaluate one sub-board again and update the sum
+	*/
+	void _update_board(uint8_t board);
+
+	void _update_meta(void);
+
+/**
+	* @brief  set up the frame of a position, score it at once if game over or horizon
+	* @param  player the one to move
+	* @note   frame with scan == scan_end is done, its score is frame->best
+	*/
+	void _search_enter(T_ULTIMATE_FRAME *frame, PLAYER_TYPE player, int16_t alpha, int16_t beta, uint8_t ply);
+
+/**
+	* @brief  score of position in view of player, player to move
+	*/
+	int16_t _search(PLAYER_TYPE player, int16_t alpha, int16_t beta);
+
+	/** pieces of every sub-board */
+	T_MATRIX_3X3 sub_map[ULTIMATE_BOARD_TOTAL][PLAYER_TYPE_MAX + 1];
+
+	/** sub-boards won */
+	T_MATRIX_3X3 meta_map[PLAYER_TYPE_MAX + 1];
+
+	/** sub-boards won or full, no move can be taken there */
+	uint16_t closed;
+
+	/** sub-board of the next move, ULTIMATE_BOARD_ANY means any open one */
+	uint8_t next_board;
+
+	/** guess of every sub-board in view of friend */
+	int8_t board_score[ULTIMATE_BOARD_TOTAL];
+
+	/** guess of meta-board in view of friend */
+	int16_t meta_score;
+
+	/** sum of board_score[] and meta_score */
+	int16_t score_sum;
+
+	T_ULTIMATE_FRAME search_stack[ULTIMATE_SEARCH_DEPTH];
+	uint8_t search_horizon;
+	bool search_abort;
+	uint32_t search_budget_us;
+	uint32_t search_start_us;
+	uint32_t search_node;
+};
+
+#endif  //EE33_ULTIMATE_H
+
+
+/*
+ * @release note
+ * | v1.0 2026-10-16 - 3lectron3ats : Initial Release
+ * #
+*/